@@ -0,0 +1,332 @@
+/*
+  ==============================================================================
+
+    AetherBenchAliasing.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    "aliasing" suite: what each quality configuration buys, against what it
+    costs.
+
+    For every distortion algorithm and engine configuration (oversampling
+    factor x IIR / linear-phase FIR, each at the full control rate and at
+    the governor's coarser one), a mono engine is driven with a
+    stepped sine sweep from 1 kHz to 16 kHz. Each tone sits on an FFT bin,
+    settles, and one Blackman-Harris windowed juce::dsp::FFT frame of the
+    output is split into the fundamental, its true harmonics, DC and the
+    rest: aliases folded back from above Nyquist, plus noise.
+
+    Per case, the worst tone of the sweep gives
+      aliasDb  residual energy below the fundamental
+      snrDb    signal (fundamental + true harmonics) over the whole residual
+      thdnDb   everything but the fundamental
+    with aliasDb and thdnDb relative to the whole output but DC: rectify
+    and the folders can leave next to nothing of the fundamental itself.
+    All three are reported next to the case's measured ns/sample, so the
+    JSON can be plotted as aliasing against CPU. Ratios are clamped to
+    +-300 dB, so a silent residual still writes valid JSON. Finally the
+    cheapest configuration whose aliasDb is at or under --alias-floor is
+    reported per algorithm and overall.
+
+  ==============================================================================
+*/
+
+#include "AetherBenchSuites.h"
+#include "AetherDSP.h"
+#include <map>
+
+namespace aether
+{
+namespace bench
+{
+
+namespace
+{
+
+struct Configuration
+{
+    const char* name;
+    EngineQuality quality;
+    bool linearPhase;
+    int tier; // Governor tier (QualityTier::get): 1 recomputes the filter every 4 oversampled samples
+};
+
+// Every oversampling setup the engine offers, at the full and at the governor's control rate
+const Configuration configurations[] = {
+    { "2x/iir/ctl4", EngineQuality::Eco, false, 1 },
+    { "2x/iir", EngineQuality::Eco, false, 0 },
+    { "2x/fir/ctl4", EngineQuality::Eco, true, 1 },
+    { "2x/fir", EngineQuality::Eco, true, 0 },
+    { "4x/iir/ctl4", EngineQuality::High, false, 1 },
+    { "4x/iir", EngineQuality::High, false, 0 },
+    { "4x/fir/ctl4", EngineQuality::High, true, 1 },
+    { "4x/fir", EngineQuality::High, true, 0 },
+};
+
+const char* algoName(DistortionAlgo a)
+{
+    static const char* names[] = { "None", "SoftClip", "HardClip", "SineFold", "TriangleWarp", "BitCrush",
+                                   "SampleReduce", "AsymSaturation", "Rectify", "Tanh", "SoftFold", "Chebyshev" };
+    return names[(int)a];
+}
+
+constexpr int fftOrder = 14;              // 16384 points, ~2.9 Hz bins at 48 kHz
+constexpr int fftSize = 1 << fftOrder;
+constexpr int lobeBins = 4;               // Blackman-Harris main lobe half-width
+constexpr int maxFoldOrder = 64;          // Harmonics that must not fold onto one another
+constexpr double settleSeconds = 0.25;    // Filters, ramps and the wake fade before the frame
+constexpr float toneLevel = 0.5f;
+constexpr double sweepHz[] = { 1000.0, 1414.0, 2000.0, 2828.0, 4000.0, 5657.0, 8000.0, 11314.0, 16000.0 };
+
+/** Hard, but not clipping every algorithm into a square wave: the drive is where aliasing matters. */
+ParameterSnapshot makeParams(DistortionAlgo algo)
+{
+    ParameterSnapshot p;
+    p.drive = 0.5f;
+    p.stages = 2;
+    p.algoPos = algo;
+    p.algoNeg = algo;
+    return p;
+}
+
+void renderSine(float* x, int numSamples, double& phase, double increment)
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        x[i] = toneLevel * (float)std::sin(phase);
+        phase += increment;
+    }
+
+    phase = std::fmod(phase, 2.0 * juce::MathConstants<double>::pi);
+}
+
+/**
+ * An FFT bin near targetHz to put the tone on. Harmonic m folds back onto
+ * harmonic j (or DC) when (m +- j) * bin is close to a multiple of the FFT
+ * size, as it is for any tone at fs/n: then aliases hide under harmonics.
+ * The first bin whose low multiples all stay clear of that is used.
+ */
+int pickToneBin(double targetHz, double sampleRate)
+{
+    auto isClear = [](int bin)
+    {
+        for (int n = 1; n <= maxFoldOrder; ++n)
+        {
+            const int r = (int)(((long long)n * bin) % fftSize);
+            if (std::min(r, fftSize - r) <= 2 * lobeBins)
+                return false;
+        }
+        return true;
+    };
+
+    const int target = juce::jmax(2 * lobeBins + 1, (int)std::round(targetHz * fftSize / sampleRate));
+
+    for (int offset = 0; offset < fftSize / 16; ++offset)
+        for (int bin : { target + offset, target - offset })
+            if (bin > 2 * lobeBins && isClear(bin))
+                return bin;
+
+    return target;
+}
+
+struct ToneAnalysis
+{
+    double toneHz = 0.0;
+    double aliasDb = 0.0;
+    double snrDb = 0.0;
+    double thdnDb = 0.0;
+};
+
+/** num / den in dB, within +-300 dB: either side may be exactly zero. */
+double toDb(double num, double den) { return 10.0 * std::log10(std::max(num, 1.0e-30) / std::max(den, 1.0e-30)); }
+
+/** Renders one tone through the engine and splits the output spectrum. */
+ToneAnalysis analyseTone(AetherEngine<float, 1>& engine, const ParameterSnapshot& params,
+                         const Options& options, double targetHz)
+{
+    // On a bin, so the tone and every harmonic or alias of it land on bins too
+    const int toneBin = pickToneBin(targetHz, options.sampleRate);
+    const double increment = 2.0 * juce::MathConstants<double>::pi * toneBin / fftSize;
+
+    const int settleSamples = (int)(settleSeconds * options.sampleRate);
+    std::vector<float> frame((size_t)fftSize * 2, 0.0f);
+    juce::AudioBuffer<float> block(1, options.blockSize);
+    double phase = 0.0;
+
+    engine.reset();
+
+    for (int done = -settleSamples; done < fftSize; done += options.blockSize)
+    {
+        renderSine(block.getWritePointer(0), options.blockSize, phase, increment);
+        engine.process(block, params);
+
+        for (int i = 0; i < options.blockSize; ++i)
+            if (done + i >= 0 && done + i < fftSize)
+                frame[(size_t)(done + i)] = block.getSample(0, i);
+    }
+
+    juce::dsp::WindowingFunction<float> window((size_t)fftSize, juce::dsp::WindowingFunction<float>::blackmanHarris, false);
+    window.multiplyWithWindowingTable(frame.data(), (size_t)fftSize);
+
+    juce::dsp::FFT fft(fftOrder);
+    fft.performFrequencyOnlyForwardTransform(frame.data());
+
+    double fundamental = 0.0, harmonics = 0.0, residual = 0.0, residualBelow = 0.0;
+
+    for (int bin = lobeBins + 1; bin <= fftSize / 2; ++bin)
+    {
+        const double power = (double)frame[(size_t)bin] * frame[(size_t)bin];
+        const int nearest = juce::jmax(1, (bin + toneBin / 2) / toneBin); // Nearest harmonic number
+
+        if (std::abs(bin - toneBin) <= lobeBins)
+            fundamental += power;
+        else if (std::abs(bin - nearest * toneBin) <= lobeBins)
+            harmonics += power;
+        else
+        {
+            residual += power;
+            if (bin < toneBin)
+                residualBelow += power;
+        }
+    }
+
+    const double total = fundamental + harmonics + residual;
+
+    ToneAnalysis result;
+    result.toneHz = toneBin * options.sampleRate / fftSize;
+    result.aliasDb = toDb(residualBelow, total);
+    result.snrDb = toDb(fundamental + harmonics, residual);
+    result.thdnDb = toDb(harmonics + residual, total);
+    return result;
+}
+
+struct Measured
+{
+    std::string algo, configuration;
+    double nsPerSample, aliasDb;
+};
+
+void benchCase(Report& report, const Options& options, DistortionAlgo algo, const Configuration& configuration,
+               std::vector<Measured>& measured)
+{
+    const std::string name = std::string("aliasing/") + algoName(algo) + "/" + configuration.name;
+    if (! report.wants(name)) return;
+
+    auto engine = std::make_unique<AetherEngine<float, 1>>();
+    engine->prepare({ options.sampleRate, (juce::uint32)options.blockSize, 1 });
+    engine->setQuality(configuration.quality);
+    engine->setLinearPhase(configuration.linearPhase);
+    engine->setTier(configuration.tier); // Applied within the first tone's settling time
+    const auto params = makeParams(algo);
+
+    // Worst tone of the sweep
+    ToneAnalysis worst;
+    int numTones = 0;
+
+    for (double hz : sweepHz)
+    {
+        if (hz >= 0.45 * options.sampleRate) continue;
+
+        const auto tone = analyseTone(*engine, params, options, hz);
+        if (numTones++ == 0)
+        {
+            worst = tone;
+            continue;
+        }
+
+        if (tone.aliasDb > worst.aliasDb)
+        {
+            worst.aliasDb = tone.aliasDb;
+            worst.toneHz = tone.toneHz;
+        }
+
+        worst.snrDb = std::min(worst.snrDb, tone.snrDb);
+        worst.thdnDb = std::max(worst.thdnDb, tone.thdnDb);
+    }
+
+    if (numTones == 0) return; // Sample rate too low for the sweep
+
+    // CPU on a mid-sweep tone: the engine's cost barely depends on the signal
+    juce::AudioBuffer<float> block(1, options.blockSize);
+    double phase = 0.0;
+    const double increment = 2.0 * juce::MathConstants<double>::pi * 4000.0 / options.sampleRate;
+    engine->reset();
+
+    auto result = measure("aliasing", name, 1, options, [&]
+    {
+        renderSine(block.getWritePointer(0), options.blockSize, phase, increment);
+        engine->process(block, params);
+        consume(block.getSample(0, options.blockSize - 1));
+    });
+
+    result.metrics.push_back({ "aliasDb", worst.aliasDb });
+    result.metrics.push_back({ "snrDb", worst.snrDb });
+    result.metrics.push_back({ "thdnDb", worst.thdnDb });
+    result.metrics.push_back({ "worstToneHz", worst.toneHz });
+    report.add(result);
+
+    measured.push_back({ algoName(algo), configuration.name, result.nsPerSample, worst.aliasDb });
+}
+
+/** The cheapest configuration at or under the floor for each algorithm, and for all of them at once. */
+void reportCheapest(Report& report, const Options& options, const std::vector<Measured>& measured)
+{
+    std::map<std::string, const Measured*> cheapest;
+    std::map<std::string, double> totalNs;    // Per configuration, over every algorithm measured
+    std::map<std::string, bool> meetsFloor;   // ... and whether all of them met the floor
+
+    for (auto& m : measured)
+    {
+        const bool meets = m.aliasDb <= options.aliasFloorDb;
+
+        auto& best = cheapest[m.algo];
+        if (meets && (best == nullptr || m.nsPerSample < best->nsPerSample))
+            best = &m;
+
+        totalNs[m.configuration] += m.nsPerSample;
+        meetsFloor.emplace(m.configuration, true).first->second &= meets;
+    }
+
+    std::string overall;
+    for (auto& t : totalNs)
+        if (meetsFloor[t.first] && (overall.empty() || t.second < totalNs[overall]))
+            overall = t.first;
+
+    std::string json = "{ \"floorDb\": " + std::to_string(options.aliasFloorDb) + ", \"overall\": "
+                     + (overall.empty() ? "null" : "\"" + overall + "\"") + ", \"perAlgorithm\": {";
+
+    bool first = true;
+    for (auto& c : cheapest)
+    {
+        json += std::string(first ? " " : ", ") + "\"" + c.first + "\": "
+              + (c.second != nullptr ? "\"" + c.second->configuration + "\"" : "null");
+        first = false;
+
+        std::fprintf(stderr, "aliasing   %-16s cheapest under %.0f dB: %s\n", c.first.c_str(), options.aliasFloorDb,
+                     c.second != nullptr ? c.second->configuration.c_str() : "none");
+    }
+
+    json += " } }";
+
+    std::fprintf(stderr, "aliasing   every algorithm under %.0f dB: %s\n", options.aliasFloorDb,
+                 overall.empty() ? "none" : overall.c_str());
+    report.addField("aliasingFloor", json);
+}
+
+} // namespace
+
+void runAliasingSuite(Report& report, const Options& options)
+{
+    std::vector<Measured> measured;
+
+    for (int a = 1; a < (int)DistortionAlgo::Count; ++a) // None is a straight wire
+        for (auto& configuration : configurations)
+            benchCase(report, options, (DistortionAlgo)a, configuration, measured);
+
+    if (! measured.empty())
+        reportCheapest(report, options, measured);
+}
+
+} // namespace bench
+} // namespace aether
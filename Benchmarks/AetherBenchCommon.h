@@ -0,0 +1,276 @@
+/*
+  ==============================================================================
+
+    AetherBenchCommon.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Shared pieces of aether_bench: options, the timing loop, deterministic
+    test signals and the JSON report.
+
+    A case is a callable that processes one block. It is run for a warm-up
+    pass, then timed over several repeats of at least minSeconds each; the
+    median repeat is reported, so one preempted repeat does not skew it.
+    With --counters the timed repeats are also counted by the PMU (see
+    AetherBenchCounters.h), which adds IPC and per-sample misses.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherBenchCounters.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aether
+{
+namespace bench
+{
+
+struct Options
+{
+    double sampleRate = 48000.0;
+    int blockSize = 512;
+    double minSeconds = 0.1; // Per repeat
+    int repeats = 5;
+    double corpusSeconds = 2.0; // Per corpus signal, whole-plugin suites
+    double stressSeconds = 30.0; // Audio rendered by the stress suite
+    uint32_t seed = 1;           // Randomised suites: same seed, same run
+    bool counters = false;       // Hardware counters around measure() (Linux)
+    uint64_t fpAssistEvent = 0;  // Raw PMU code for FP assists, 0 to skip them
+    double aliasFloorDb = -60.0; // Aliasing suite: the floor a configuration must meet
+    int instances = 0;           // Density suite: fixed instance count, 0 to search for the maximum
+    int threads = 0;             // Density suite: render threads, 0 for one per core
+    bool editors = false;        // Density suite: an offscreen editor per instance
+    std::string filter;      // Only cases whose name contains this
+    std::string outputPath;  // JSON goes to stdout if empty
+};
+
+struct Result
+{
+    std::string suite;
+    std::string name;
+    int channels = 1;
+    double nsPerSample = 0.0;       // Per channel-sample, median repeat
+    double samplesPerSecond = 0.0;  // Channel-samples per second on one core
+    double instancesPerCore = 0.0;  // Real-time instances of this case one core could run
+
+    std::vector<std::pair<std::string, double>> metrics; // Suite-specific extras, written alongside
+};
+
+/** Nearest-rank percentile (0..100) of unsorted values; 0 if empty. */
+inline double percentile(std::vector<double> values, double p)
+{
+    if (values.empty()) return 0.0;
+
+    std::sort(values.begin(), values.end());
+    const auto rank = (size_t)std::ceil(p / 100.0 * (double)values.size());
+    return values[std::min(values.size() - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+/** Small deterministic generator: the same seed gives the same signal on every machine. */
+class Random
+{
+public:
+    explicit Random(uint32_t seed) : state(seed ? seed : 1u) {}
+
+    uint32_t next()
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    /** Uniform in [-1, 1). */
+    float bipolar() { return (float)((double)next() / 2147483648.0 - 1.0); }
+
+private:
+    uint32_t state;
+};
+
+/** Bass-heavy test signal: 55 Hz + 110 Hz + 880 Hz partials and a little noise, peak about 0.8. */
+inline std::vector<float> makeTestSignal(double sampleRate, int numSamples, uint32_t seed = 1)
+{
+    std::vector<float> x((size_t)numSamples);
+    Random random(seed);
+    const double w = 2.0 * 3.14159265358979323846 / sampleRate;
+
+    for (int i = 0; i < numSamples; ++i)
+        x[(size_t)i] = (float)(0.4 * std::sin(w * 55.0 * i) + 0.2 * std::sin(w * 110.0 * i)
+                             + 0.1 * std::sin(w * 880.0 * i)) + 0.05f * random.bipolar();
+
+    return x;
+}
+
+/** Keeps the optimiser from discarding the processed output. */
+inline void consume(float value)
+{
+    static volatile float sink = 0.0f;
+    sink = sink + value;
+}
+
+/**
+ * Times processBlock (which processes options.blockSize samples of `channels`
+ * channels per call) and fills in the rates.
+ */
+inline Result measure(const std::string& suite, const std::string& name, int channels,
+                      const Options& options, const std::function<void()>& processBlock)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Warm-up: caches, branch predictors, lazily built tables, denormal-free state
+    for (int i = 0; i < 16; ++i)
+        processBlock();
+
+    std::vector<double> perSample;
+    double countedSamples = 0.0;
+
+    std::unique_ptr<HardwareCounters> counters;
+    if (options.counters)
+    {
+        counters = std::make_unique<HardwareCounters>(options.fpAssistEvent);
+        counters->start();
+    }
+
+    for (int r = 0; r < std::max(1, options.repeats); ++r)
+    {
+        long long blocks = 0;
+        const auto start = Clock::now();
+        double elapsed = 0.0;
+
+        do
+        {
+            for (int i = 0; i < 8; ++i)
+                processBlock();
+
+            blocks += 8;
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        }
+        while (elapsed < options.minSeconds);
+
+        perSample.push_back(elapsed * 1.0e9 / ((double)blocks * options.blockSize * channels));
+        countedSamples += (double)blocks * options.blockSize * channels;
+    }
+
+    if (counters != nullptr)
+        counters->stop();
+
+    std::sort(perSample.begin(), perSample.end());
+
+    Result result;
+    result.suite = suite;
+    result.name = name;
+    result.channels = channels;
+    result.nsPerSample = perSample[perSample.size() / 2];
+    result.samplesPerSecond = 1.0e9 / result.nsPerSample;
+    result.instancesPerCore = result.samplesPerSecond / (options.sampleRate * channels);
+
+    if (counters != nullptr)
+        counters->addMetrics(result.metrics, countedSamples);
+
+    return result;
+}
+
+/** Collects results and writes them as one JSON document. */
+class Report
+{
+public:
+    explicit Report(const Options& o) : options(o) {}
+
+    bool wants(const std::string& name) const
+    {
+        return options.filter.empty() || name.find(options.filter) != std::string::npos;
+    }
+
+    void add(const Result& r)
+    {
+        std::fprintf(stderr, "%-10s %-40s %9.2f ns/sample %8.1f inst/core",
+                     r.suite.c_str(), r.name.c_str(), r.nsPerSample, r.instancesPerCore);
+
+        for (auto& m : r.metrics)
+            std::fprintf(stderr, "  %s %.3f", m.first.c_str(), m.second);
+
+        std::fprintf(stderr, "\n");
+        results.push_back(r);
+    }
+
+    /** Extra top-level fields, written verbatim (value must already be valid JSON). */
+    void addField(const std::string& key, const std::string& jsonValue)
+    {
+        fields.push_back({ key, jsonValue });
+    }
+
+    const std::vector<Result>& getResults() const { return results; }
+
+    bool write(const char* isaName) const
+    {
+        FILE* f = options.outputPath.empty() ? stdout : std::fopen(options.outputPath.c_str(), "w");
+        if (f == nullptr)
+        {
+            std::fprintf(stderr, "aether_bench: cannot write %s\n", options.outputPath.c_str());
+            return false;
+        }
+
+        std::fprintf(f, "{\n  \"sampleRate\": %.1f,\n  \"blockSize\": %d,\n  \"isa\": \"%s\",\n",
+                     options.sampleRate, options.blockSize, isaName);
+
+        for (auto& field : fields)
+            std::fprintf(f, "  \"%s\": %s,\n", field.first.c_str(), field.second.c_str());
+
+        std::fprintf(f, "  \"results\": [\n");
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& r = results[i];
+            std::fprintf(f, "    { \"suite\": \"%s\", \"name\": \"%s\", \"channels\": %d, \"nsPerSample\": %.4f, "
+                            "\"samplesPerSecond\": %.1f, \"instancesPerCore\": %.2f",
+                         escape(r.suite).c_str(), escape(r.name).c_str(), r.channels, r.nsPerSample,
+                         r.samplesPerSecond, r.instancesPerCore);
+
+            // JSON has no inf or nan: a metric that is not finite is written as null
+            for (auto& m : r.metrics)
+            {
+                if (std::isfinite(m.second)) std::fprintf(f, ", \"%s\": %.4f", escape(m.first).c_str(), m.second);
+                else std::fprintf(f, ", \"%s\": null", escape(m.first).c_str());
+            }
+
+            std::fprintf(f, " }%s\n", i + 1 < results.size() ? "," : "");
+        }
+
+        std::fprintf(f, "  ]\n}\n");
+
+        if (f != stdout)
+            std::fclose(f);
+
+        return true;
+    }
+
+private:
+    static std::string escape(const std::string& text)
+    {
+        std::string out;
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\') out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+    const Options& options;
+    std::vector<Result> results;
+    std::vector<std::pair<std::string, std::string>> fields;
+};
+
+} // namespace bench
+} // namespace aether
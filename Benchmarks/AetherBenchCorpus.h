@@ -0,0 +1,113 @@
+/*
+  ==============================================================================
+
+    AetherBenchCorpus.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    The standard input corpus for whole-plugin runs: sine sweep, drum loop,
+    noise and silence. Everything is synthesised from fixed seeds, so a
+    given rate and length always gives the same samples.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherBenchCommon.h"
+
+namespace aether
+{
+namespace bench
+{
+
+struct CorpusItem
+{
+    const char* name;
+    std::vector<float> samples; // Mono; played on every channel
+};
+
+/** Exponential sine sweep, 20 Hz to 20 kHz (capped below Nyquist), -6 dBFS. */
+inline std::vector<float> makeSweep(double sampleRate, int numSamples)
+{
+    std::vector<float> x((size_t)numSamples);
+    const double f0 = 20.0, f1 = std::min(20000.0, sampleRate * 0.45);
+    const double seconds = numSamples / sampleRate;
+    const double k = std::log(f1 / f0);
+    const double twoPi = 2.0 * 3.14159265358979323846;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const double t = i / sampleRate;
+        x[(size_t)i] = (float)(0.5 * std::sin(twoPi * f0 * seconds / k * (std::exp(t / seconds * k) - 1.0)));
+    }
+
+    return x;
+}
+
+/** 174 BPM kick / snare / hat loop: pitched-down sine kicks, noisy snares, short hats. */
+inline std::vector<float> makeDrumLoop(double sampleRate, int numSamples, uint32_t seed = 2)
+{
+    std::vector<float> x((size_t)numSamples, 0.0f);
+    Random random(seed);
+    const int sixteenth = (int)(sampleRate * 60.0 / 174.0 / 4.0);
+    const double twoPi = 2.0 * 3.14159265358979323846;
+
+    // Two-step pattern over 16 sixteenths
+    const char* kicks  = "x.........x.....";
+    const char* snares = "....x.......x...";
+
+    for (int step = 0; step * sixteenth < numSamples; ++step)
+    {
+        const int start = step * sixteenth;
+        const int s = step % 16;
+
+        for (int i = 0; i < sixteenth * 4 && start + i < numSamples; ++i)
+        {
+            const double t = i / sampleRate;
+            float v = 0.0f;
+
+            if (kicks[s] == 'x')
+            {
+                const double phase = twoPi * (50.0 * t + 100.0 * 0.03 * (1.0 - std::exp(-t / 0.03)));
+                v += (float)(0.8 * std::sin(phase) * std::exp(-t / 0.25));
+            }
+
+            if (snares[s] == 'x')
+                v += (float)(std::exp(-t / 0.08) * (0.3 * std::sin(twoPi * 190.0 * t) + 0.35 * random.bipolar()));
+
+            if (i < sixteenth) // Hat on every step
+                v += (float)(0.12 * std::exp(-t / 0.015)) * random.bipolar();
+
+            x[(size_t)(start + i)] += v;
+        }
+    }
+
+    return x;
+}
+
+/** Uniform white noise, -12 dBFS peak. */
+inline std::vector<float> makeNoise(int numSamples, uint32_t seed = 3)
+{
+    std::vector<float> x((size_t)numSamples);
+    Random random(seed);
+    for (auto& v : x)
+        v = 0.25f * random.bipolar();
+    return x;
+}
+
+/** Sweep, drums, noise and silence, secondsEach long each. */
+inline std::vector<CorpusItem> makeCorpus(double sampleRate, double secondsEach)
+{
+    const int n = std::max(1, (int)(sampleRate * secondsEach));
+    return {
+        { "sweep", makeSweep(sampleRate, n) },
+        { "drums", makeDrumLoop(sampleRate, n) },
+        { "noise", makeNoise(n) },
+        { "silence", std::vector<float>((size_t)n, 0.0f) },
+    };
+}
+
+} // namespace bench
+} // namespace aether
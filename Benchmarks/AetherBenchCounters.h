@@ -0,0 +1,196 @@
+/*
+  ==============================================================================
+
+    AetherBenchCounters.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Hardware performance counters for aether_bench --counters (Linux).
+
+    Each counter is opened with perf_event_open on the calling thread,
+    counting user space only. The counters are opened one by one rather
+    than as a group, so one the PMU or a VM does not offer is just left
+    out. When there are more counters than PMU slots the kernel multiplexes
+    them, and every count is scaled by enabled / running time.
+
+    FP assists (denormal and other microcode-assisted FP operations) have no
+    generic perf event. Pass this CPU's raw event code with
+    --fp-assist-event, e.g. 0x1eca for FP_ASSIST.ANY on Skylake, or 0x02c1
+    for ASSISTS.FP on Ice Lake and later.
+
+    The kernel may refuse counters (perf_event_paranoid > 2, or no PMU in
+    a container). Then isAvailable() is false and getError() says why.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+ #include <cerrno>
+ #include <cstring>
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#endif
+
+namespace aether
+{
+namespace bench
+{
+
+class HardwareCounters
+{
+public:
+    /** Opens every counter it can. fpAssistEvent is a raw PMU event code (0: none). */
+    explicit HardwareCounters(uint64_t fpAssistEvent = 0)
+    {
+       #if defined(__linux__)
+        const uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                   | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const uint64_t llcReadMiss = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                   | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+        open("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        open("instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        open("branchMisses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+        open("l1dMisses", PERF_TYPE_HW_CACHE, l1dReadMiss);
+        open("llcMisses", PERF_TYPE_HW_CACHE, llcReadMiss);
+
+        if (fpAssistEvent != 0)
+            open("fpAssists", PERF_TYPE_RAW, fpAssistEvent);
+       #else
+        (void)fpAssistEvent;
+        error = "hardware counters need Linux perf_event_open";
+       #endif
+    }
+
+    ~HardwareCounters()
+    {
+       #if defined(__linux__)
+        for (auto& c : counters)
+            close(c.fd);
+       #endif
+    }
+
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    /** True if at least cycles and instructions could be opened. */
+    bool isAvailable() const { return find("cycles") >= 0 && find("instructions") >= 0; }
+
+    /** Why a counter is missing (the first failure), empty if all opened. */
+    const std::string& getError() const { return error; }
+
+    std::vector<std::string> getNames() const
+    {
+        std::vector<std::string> names;
+        for (auto& c : counters)
+            names.push_back(c.name);
+        return names;
+    }
+
+    void start()
+    {
+       #if defined(__linux__)
+        for (auto& c : counters)
+        {
+            ioctl(c.fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(c.fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+       #endif
+    }
+
+    void stop()
+    {
+       #if defined(__linux__)
+        for (auto& c : counters)
+            ioctl(c.fd, PERF_EVENT_IOC_DISABLE, 0);
+       #endif
+    }
+
+    /**
+     * Adds IPC and per-sample counts since start() to `metrics`, for
+     * `numSamples` channel-samples. A counter that never got PMU time is left out.
+     */
+    void addMetrics(std::vector<std::pair<std::string, double>>& metrics, double numSamples) const
+    {
+        std::vector<double> values;
+        for (auto& c : counters)
+            values.push_back(read(c));
+
+        const int cycles = find("cycles"), instructions = find("instructions");
+        if (cycles >= 0 && instructions >= 0 && values[(size_t)cycles] > 0.0)
+            metrics.push_back({ "ipc", values[(size_t)instructions] / values[(size_t)cycles] });
+
+        for (size_t i = 0; i < counters.size(); ++i)
+            if (values[i] >= 0.0)
+                metrics.push_back({ counters[i].name + "PerSample", values[i] / numSamples });
+    }
+
+private:
+    struct Counter
+    {
+        std::string name;
+        int fd = -1;
+    };
+
+    int find(const std::string& name) const
+    {
+        for (size_t i = 0; i < counters.size(); ++i)
+            if (counters[i].name == name)
+                return (int)i;
+        return -1;
+    }
+
+   #if defined(__linux__)
+    void open(const char* name, uint32_t type, uint64_t config)
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0); // This thread, any CPU
+
+        if (fd < 0)
+        {
+            if (error.empty())
+                error = std::string(name) + ": " + std::strerror(errno);
+            return;
+        }
+
+        counters.push_back({ name, fd });
+    }
+
+    /** Scaled count, or -1 if the counter was never scheduled. */
+    static double read(const Counter& c)
+    {
+        uint64_t v[3] = {}; // value, time enabled, time running
+        if (::read(c.fd, v, sizeof(v)) != (ssize_t)sizeof(v) || v[2] == 0)
+            return -1.0;
+
+        return (double)v[0] * ((double)v[1] / (double)v[2]);
+    }
+   #else
+    static double read(const Counter&) { return -1.0; }
+   #endif
+
+    std::vector<Counter> counters;
+    std::string error;
+};
+
+} // namespace bench
+} // namespace aether
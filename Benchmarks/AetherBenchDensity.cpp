@@ -0,0 +1,480 @@
+/*
+  ==============================================================================
+
+    AetherBenchDensity.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    "density" suite: how many instances fit in a session, and what each
+    one costs in memory.
+
+    Memory: the heap one stereo instance takes, from the allocator's own
+    bytes-in-use (glibc), measured around each large module prepared as the
+    engine prepares it, the whole engine, the processor and (--editors)
+    its editor. Modules that appear twice per engine (L/R) are counted
+    twice. The process RSS is read at the end, and its growth divided by
+    the number of instances created.
+
+    Realtime: N headless processors, each with its own input, render one
+    block each per cycle on a pool of --threads workers (the caller
+    included), as a host's audio thread and worker threads would. A cycle
+    has the block's real-time budget, and N is sustained when the p99
+    cycle time fits in it. N doubles until it fails and is then bisected,
+    unless --instances fixes it. With --editors every instance also has an
+    editor: it is never on screen, so nothing paints, but its timers run
+    on the message thread while the pool renders.
+
+    Uses the default patch, --rate and --block.
+
+  ==============================================================================
+*/
+
+#include "AetherBenchSuites.h"
+#include "AetherDSP.h"
+#include "PluginProcessor.h"
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(__GLIBC__)
+ #include <malloc.h>
+#endif
+
+#if defined(__APPLE__)
+ #include <mach/mach.h>
+#endif
+
+namespace aether
+{
+namespace bench
+{
+
+namespace
+{
+
+constexpr int maxInstances = 1024;
+constexpr double trialSeconds = 2.0; // Audio rendered per instance count
+constexpr int warmUpCycles = 16;
+
+/** Heap bytes in use, 0 where the allocator cannot say. */
+size_t getHeapInUse()
+{
+   #if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd; // Arena chunks + mmapped blocks (large buffers)
+   #elif defined(__GLIBC__)
+    const auto info = mallinfo();
+    return (size_t)(unsigned)info.uordblks + (size_t)(unsigned)info.hblkhd;
+   #else
+    return 0;
+   #endif
+}
+
+/** Resident set size of the process in bytes, 0 if unknown. */
+size_t getResidentBytes()
+{
+   #if defined(__linux__)
+    long pages = 0, resident = 0;
+    if (FILE* f = std::fopen("/proc/self/statm", "r"))
+    {
+        if (std::fscanf(f, "%ld %ld", &pages, &resident) != 2) resident = 0;
+        std::fclose(f);
+    }
+    return (size_t)resident * (size_t)sysconf(_SC_PAGESIZE);
+   #elif defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) != KERN_SUCCESS)
+        return 0;
+    return (size_t)info.resident_size;
+   #else
+    return 0;
+   #endif
+}
+
+/** Heap growth while the object build() returns is alive. */
+template <typename Build>
+double measureHeap(Build&& build)
+{
+    const auto before = getHeapInUse();
+    const auto object = build();
+    const auto after = getHeapInUse();
+    return after > before ? (double)(after - before) : 0.0;
+}
+
+template <typename Module, typename... Args>
+std::unique_ptr<Module> makePrepared(Args&&... args)
+{
+    auto module = std::make_unique<Module>();
+    module->prepare(std::forward<Args>(args)...);
+    return module;
+}
+
+/** Per-instance heap by module, as metrics; empty without a heap counter. */
+std::vector<std::pair<std::string, double>> measureInstanceHeap(const Options& options)
+{
+    std::vector<std::pair<std::string, double>> metrics;
+    if (getHeapInUse() == 0) return metrics;
+
+    const juce::dsp::ProcessSpec spec { options.sampleRate, (juce::uint32)options.blockSize, 2 };
+    auto oversampledSpec = spec; // The high band is prepared at 4x (see AetherEngine::prepare)
+    oversampledSpec.sampleRate *= 4.0;
+    oversampledSpec.maximumBlockSize = (juce::uint32)AETHER_TILE_SIZE * 4;
+
+    const int maxLatency = makePrepared<AetherOversampler<float>>(AETHER_TILE_SIZE)->getMaxLatencySamples();
+
+    const std::pair<const char*, double> modules[] = {
+        { "Resonator", 2.0 * measureHeap([&] { return makePrepared<AetherResonator<float>>(oversampledSpec); }) },
+        { "Filter", 2.0 * measureHeap([&] { return makePrepared<AetherFilter<float>>(oversampledSpec); }) },
+        { "Dimension", measureHeap([&] { return makePrepared<AetherDimension>(oversampledSpec); }) },
+        { "Oversampler", measureHeap([&] { return makePrepared<AetherOversampler<float>>(AETHER_TILE_SIZE); }) },
+        { "LowDelay", measureHeap([&] { return makePrepared<DelayCompensation<float>>(2, maxLatency); }) },
+        { "LinearCrossover", measureHeap([&] { return makePrepared<AetherLinearPhaseCrossover>(spec.sampleRate); }) },
+        { "Noise", measureHeap([&] { return makePrepared<AetherNoise<float>>(spec.sampleRate); }) },
+    };
+
+    const double engine = measureHeap([&] { return makePrepared<AetherEngine<float, 2>>(spec); });
+    double modulesTotal = 0.0;
+
+    for (auto& m : modules)
+    {
+        metrics.push_back({ std::string("heap") + m.first + "Bytes", m.second });
+        modulesTotal += m.second;
+    }
+
+    // The engine object itself, tiles, ramps and anything the list above misses
+    metrics.push_back({ "heapEngineOtherBytes", std::max(0.0, engine - modulesTotal) });
+    metrics.push_back({ "heapEngineBytes", engine });
+
+    auto makeProcessor = [&]
+    {
+        auto processor = std::make_unique<AetherAudioProcessor>();
+        processor->setRateAndBufferSizeDetails(options.sampleRate, options.blockSize);
+        processor->prepareToPlay(options.sampleRate, options.blockSize);
+        return processor;
+    };
+
+    // The first processor and editor also pay one-off allocations (singletons,
+    // caches, fonts), so each is measured as the second of its kind
+    makeProcessor().reset();
+    metrics.push_back({ "heapProcessorBytes", measureHeap(makeProcessor) });
+
+    if (options.editors)
+    {
+        auto processor = makeProcessor();
+        auto makeEditor = [&] { return std::unique_ptr<juce::AudioProcessorEditor>(processor->createEditorIfNeeded()); };
+
+        makeEditor().reset();
+        metrics.push_back({ "heapEditorBytes", measureHeap(makeEditor) });
+    }
+
+    return metrics;
+}
+
+/**
+ * RenderPool: runs a batch of jobs on its workers and the calling thread,
+ * returning when all are done. Workers sleep between batches; the caller
+ * spins, as a host's audio thread waits for its workers.
+ */
+class RenderPool
+{
+public:
+    explicit RenderPool(int numThreads)
+    {
+        for (int i = 1; i < numThreads; ++i)
+            workers.emplace_back([this] { workerLoop(); });
+    }
+
+    ~RenderPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+
+        wake.notify_all();
+        for (auto& w : workers)
+            w.join();
+    }
+
+    /** job(index, thread) for every index in [0, numJobs), thread in [0, numThreads). */
+    void run(int numJobs, const std::function<void(int, int)>& job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current = &job;
+            jobCount = numJobs;
+            nextJob.store(0, std::memory_order_relaxed);
+            finishedWorkers.store(0, std::memory_order_relaxed);
+            ++generation;
+        }
+
+        wake.notify_all();
+        work(job, numJobs, 0);
+
+        // Every worker has left this batch before the next one can start
+        while (finishedWorkers.load(std::memory_order_acquire) < (int)workers.size())
+            std::this_thread::yield();
+    }
+
+    int getNumThreads() const { return (int)workers.size() + 1; }
+
+private:
+    void work(const std::function<void(int, int)>& job, int numJobs, int thread)
+    {
+        for (int i = nextJob.fetch_add(1, std::memory_order_relaxed); i < numJobs;
+             i = nextJob.fetch_add(1, std::memory_order_relaxed))
+            job(i, thread);
+    }
+
+    void workerLoop()
+    {
+        const int thread = ++workerCount;
+        uint64_t seen = 0;
+
+        for (;;)
+        {
+            const std::function<void(int, int)>* job = nullptr;
+            int numJobs = 0;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return quit || generation != seen; });
+                if (quit) return;
+
+                seen = generation;
+                job = current;
+                numJobs = jobCount;
+            }
+
+            work(*job, numJobs, thread);
+            finishedWorkers.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    const std::function<void(int, int)>* current = nullptr;
+    int jobCount = 0;
+    uint64_t generation = 0;
+    bool quit = false;
+    std::atomic<int> nextJob { 0 }, finishedWorkers { 0 }, workerCount { 0 };
+};
+
+struct Instance
+{
+    std::unique_ptr<AetherAudioProcessor> processor;
+    std::unique_ptr<juce::AudioProcessorEditor> editor; // Declared after the processor: deleted first
+    juce::AudioBuffer<float> block;
+    int position = 0;
+};
+
+struct Trial
+{
+    bool sustained = false;
+    double averageCycleSeconds = 0.0;
+    double p99CycleSeconds = 0.0;
+    double processSeconds = 0.0; // Summed processBlock() time, every thread
+    long long samples = 0;       // Channel-samples rendered
+};
+
+class DensityRun
+{
+public:
+    DensityRun(const Options& o, int numThreads)
+        : options(o), pool(numThreads), signal(makeTestSignal(o.sampleRate, (int)o.sampleRate)),
+          threadSeconds((size_t)numThreads, 0.0)
+    {
+    }
+
+    /** Renders trialSeconds with the first numInstances instances, creating them as needed. */
+    Trial run(int numInstances)
+    {
+        while ((int)instances.size() < numInstances)
+            addInstance();
+
+        const int blockSize = options.blockSize;
+        const double budget = blockSize / options.sampleRate;
+        const int cycles = juce::jmax(32, (int)std::ceil(trialSeconds / budget));
+
+        std::fill(threadSeconds.begin(), threadSeconds.end(), 0.0);
+        std::vector<double> cycleSeconds;
+        cycleSeconds.reserve((size_t)cycles);
+
+        const std::function<void(int, int)> job = [this](int index, int thread) { renderInstance(index, thread); };
+
+        for (int c = 0; c < warmUpCycles + cycles; ++c)
+        {
+            const auto start = Clock::now();
+            pool.run(numInstances, job);
+
+            if (c >= warmUpCycles)
+                cycleSeconds.push_back(std::chrono::duration<double>(Clock::now() - start).count());
+            else if (c == warmUpCycles - 1)
+                std::fill(threadSeconds.begin(), threadSeconds.end(), 0.0);
+        }
+
+        Trial trial;
+        trial.p99CycleSeconds = percentile(cycleSeconds, 99.0);
+        trial.sustained = trial.p99CycleSeconds <= budget;
+
+        for (double s : cycleSeconds) trial.averageCycleSeconds += s / cycles;
+        for (double s : threadSeconds) trial.processSeconds += s;
+
+        trial.samples = (long long)cycles * numInstances * blockSize * instances[0].block.getNumChannels();
+
+        std::fprintf(stderr, "density    %4d instances: p99 cycle %8.1f us of %.1f us %s\n", numInstances,
+                     trial.p99CycleSeconds * 1.0e6, budget * 1.0e6, trial.sustained ? "ok" : "over");
+        return trial;
+    }
+
+    int getNumInstances() const { return (int)instances.size(); }
+    int getNumChannels() const { return instances.empty() ? 2 : instances[0].block.getNumChannels(); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void addInstance()
+    {
+        Instance instance;
+        instance.processor = std::make_unique<AetherAudioProcessor>();
+        instance.processor->setRateAndBufferSizeDetails(options.sampleRate, options.blockSize);
+        instance.processor->prepareToPlay(options.sampleRate, options.blockSize);
+        instance.block.setSize(instance.processor->getTotalNumOutputChannels(), options.blockSize);
+
+        // Spread the inputs over the signal so no two instances see the same block
+        instance.position = (int)((instances.size() * 7919) % (signal.size() - (size_t)options.blockSize));
+
+        if (options.editors)
+        {
+            const juce::MessageManagerLock lock; // Built on this thread while the message thread runs
+            instance.editor.reset(instance.processor->createEditorIfNeeded());
+        }
+
+        instances.push_back(std::move(instance));
+    }
+
+    void renderInstance(int index, int thread)
+    {
+        auto& instance = instances[(size_t)index];
+        const int blockSize = options.blockSize;
+        const auto start = Clock::now();
+
+        if (instance.position + blockSize > (int)signal.size())
+            instance.position = 0;
+
+        for (int ch = 0; ch < instance.block.getNumChannels(); ++ch)
+            instance.block.copyFrom(ch, 0, signal.data() + instance.position, blockSize);
+
+        instance.position += blockSize;
+
+        juce::MidiBuffer midi;
+        instance.processor->processBlock(instance.block, midi);
+        consume(instance.block.getSample(0, blockSize - 1));
+
+        threadSeconds[(size_t)thread] += std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    const Options& options;
+    RenderPool pool;
+    std::vector<float> signal;
+    std::vector<Instance> instances;
+    std::vector<double> threadSeconds; // One writer each
+};
+
+} // namespace
+
+void runDensitySuite(Report& report, const Options& options)
+{
+    const std::string name = "density/b" + std::to_string(options.blockSize) + (options.editors ? "/editors" : "");
+    if (! report.wants(name)) return;
+
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    const int numThreads = options.threads > 0 ? options.threads : juce::jmax(1, (int)std::thread::hardware_concurrency());
+    auto heap = measureInstanceHeap(options);
+    const auto residentBefore = getResidentBytes();
+
+    int best = 0;
+    Trial bestTrial, lastTrial;
+    int numInstances = 0;
+    DensityRun density(options, numThreads);
+
+    // The search renders on its own thread, like a host's audio thread, while
+    // this one dispatches messages: editor timers, async parameter updates
+    std::thread audio([&]
+    {
+        auto attempt = [&](int n)
+        {
+            lastTrial = density.run(n);
+            if (lastTrial.sustained && n > best)
+            {
+                best = n;
+                bestTrial = lastTrial;
+            }
+            return lastTrial.sustained;
+        };
+
+        if (options.instances > 0)
+        {
+            attempt(options.instances);
+        }
+        else
+        {
+            int low = 0, high = maxInstances + 1;
+
+            for (int n = 1; n <= maxInstances; n *= 2)
+            {
+                if (! attempt(n)) { high = n; break; }
+                low = n;
+            }
+
+            while (high - low > 1 && high <= maxInstances)
+            {
+                const int mid = (low + high) / 2;
+                (attempt(mid) ? low : high) = mid;
+            }
+        }
+
+        numInstances = density.getNumInstances();
+        juce::MessageManager::getInstance()->stopDispatchLoop();
+    });
+
+    juce::MessageManager::getInstance()->runDispatchLoop();
+    audio.join();
+
+    const auto residentAfter = getResidentBytes();
+    const int numChannels = density.getNumChannels();
+
+    // Nothing sustained: describe the smallest attempt instead
+    const auto& trial = best > 0 ? bestTrial : lastTrial;
+
+    Result r;
+    r.suite = "density";
+    r.name = name;
+    r.channels = numChannels;
+    r.nsPerSample = trial.samples > 0 ? trial.processSeconds * 1.0e9 / (double)trial.samples : 0.0;
+    r.samplesPerSecond = r.nsPerSample > 0.0 ? 1.0e9 / r.nsPerSample : 0.0;
+    r.instancesPerCore = (double)best / numThreads;
+    r.metrics = {
+        { "maxInstances", (double)best },
+        { "threads", (double)numThreads },
+        { "budgetUs", options.blockSize / options.sampleRate * 1.0e6 },
+        { "avgCycleUs", trial.averageCycleSeconds * 1.0e6 },
+        { "p99CycleUs", trial.p99CycleSeconds * 1.0e6 },
+        { "instancesCreated", (double)numInstances },
+        { "rssBytes", (double)residentAfter },
+        { "rssPerInstanceBytes", numInstances > 0 && residentAfter > residentBefore
+                                     ? (double)(residentAfter - residentBefore) / numInstances : 0.0 },
+    };
+
+    r.metrics.insert(r.metrics.end(), heap.begin(), heap.end());
+    report.add(r);
+}
+
+} // namespace bench
+} // namespace aether
@@ -0,0 +1,155 @@
+/*
+  ==============================================================================
+
+    AetherBenchMain.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    aether_bench: measures the DSP outside a DAW and writes JSON.
+
+      aether_bench [suite...] [--rate HZ] [--block N] [--seconds S]
+                   [--repeats N] [--corpus S] [--duration S] [--seed N]
+                   [--filter TEXT] [--out FILE]
+                   [--counters [--fp-assist-event HEX]] [--alias-floor DB]
+                   [--instances N] [--threads N] [--editors]
+
+    With no suite every suite runs. Progress goes to stderr, JSON to
+    stdout (or --out), so runs can be diffed and tracked over time.
+    --counters adds hardware counter metrics (IPC, misses per sample) to
+    every case timed by measure() (modules, aliasing). Linux only.
+
+  ==============================================================================
+*/
+
+#include "AetherBenchSuites.h"
+#include "AetherKernels.h"
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+
+struct Suite
+{
+    const char* name;
+    void (*run)(aether::bench::Report&, const aether::bench::Options&);
+};
+
+const Suite suites[] = {
+    { "modules", aether::bench::runModuleSuite },
+    { "presets", aether::bench::runPresetSuite },
+    { "stress", aether::bench::runStressSuite },
+    { "aliasing", aether::bench::runAliasingSuite },
+    { "density", aether::bench::runDensitySuite },
+};
+
+int usage()
+{
+    std::fprintf(stderr, "usage: aether_bench [suite...] [--rate HZ] [--block N] [--seconds S] [--repeats N] [--corpus S] [--duration S] [--seed N] [--filter TEXT] [--out FILE] [--counters [--fp-assist-event HEX]] [--alias-floor DB] [--instances N] [--threads N] [--editors]\nsuites:");
+    for (auto& s : suites)
+        std::fprintf(stderr, " %s", s.name);
+    std::fprintf(stderr, "\n");
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    aether::bench::Options options;
+    std::vector<const Suite*> selected;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (std::strcmp(arg, "--counters") == 0)
+        {
+            options.counters = true;
+            continue;
+        }
+
+        if (std::strcmp(arg, "--editors") == 0)
+        {
+            options.editors = true;
+            continue;
+        }
+
+        const bool takesValue = arg[0] == '-';
+
+        if (takesValue && value == nullptr)
+            return usage();
+
+        if (std::strcmp(arg, "--rate") == 0)          options.sampleRate = std::atof(value);
+        else if (std::strcmp(arg, "--block") == 0)    options.blockSize = std::atoi(value);
+        else if (std::strcmp(arg, "--seconds") == 0)  options.minSeconds = std::atof(value);
+        else if (std::strcmp(arg, "--repeats") == 0)  options.repeats = std::atoi(value);
+        else if (std::strcmp(arg, "--corpus") == 0)   options.corpusSeconds = std::atof(value);
+        else if (std::strcmp(arg, "--duration") == 0) options.stressSeconds = std::atof(value);
+        else if (std::strcmp(arg, "--seed") == 0)     options.seed = (uint32_t)std::strtoul(value, nullptr, 10);
+        else if (std::strcmp(arg, "--filter") == 0)   options.filter = value;
+        else if (std::strcmp(arg, "--out") == 0)      options.outputPath = value;
+        else if (std::strcmp(arg, "--fp-assist-event") == 0) options.fpAssistEvent = std::strtoull(value, nullptr, 16);
+        else if (std::strcmp(arg, "--alias-floor") == 0) options.aliasFloorDb = std::atof(value);
+        else if (std::strcmp(arg, "--instances") == 0) options.instances = std::atoi(value);
+        else if (std::strcmp(arg, "--threads") == 0)  options.threads = std::atoi(value);
+        else if (takesValue)                          return usage();
+        else
+        {
+            const Suite* found = nullptr;
+            for (auto& s : suites)
+                if (std::strcmp(arg, s.name) == 0)
+                    found = &s;
+
+            if (found == nullptr)
+                return usage();
+
+            selected.push_back(found);
+            continue;
+        }
+
+        ++i; // Skip the option's value
+    }
+
+    if (options.sampleRate <= 0.0 || options.blockSize <= 0)
+        return usage();
+
+    if (selected.empty())
+        for (auto& s : suites)
+            selected.push_back(&s);
+
+    // Same FP environment as a host's audio thread
+    juce::ScopedNoDenormals noDenormals;
+    aether::bench::Report report(options);
+
+    // Probe once: say what is missing up front rather than per case, and record what was counted
+    if (options.counters)
+    {
+        aether::bench::HardwareCounters probe(options.fpAssistEvent);
+
+        if (! probe.getError().empty())
+            std::fprintf(stderr, "aether_bench: counter unavailable (%s)\n", probe.getError().c_str());
+
+        if (! probe.isAvailable())
+        {
+            std::fprintf(stderr, "aether_bench: no cycle/instruction counters, running without --counters\n");
+            options.counters = false;
+        }
+        else
+        {
+            std::string names;
+            for (auto& name : probe.getNames())
+                names += (names.empty() ? "\"" : ", \"") + name + "\"";
+
+            report.addField("counters", "[" + names + "]");
+        }
+    }
+
+    for (auto* s : selected)
+        s->run(report, options);
+
+    return report.write(aether::kernels::get().isaName) ? 0 : 1;
+}
@@ -0,0 +1,450 @@
+/*
+  ==============================================================================
+
+    AetherBenchModules.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    "modules" suite: every DSP class on its own, fed the same test signal
+    with fixed parameters, one block at a time.
+
+    Modules run at the bench sample rate. Inside the engine the high-band
+    modules (distortion, filter, resonator, dimension) run at 2-8x that
+    rate, so their instancesPerCore is an upper bound for a full engine.
+
+    The bus cases run the engine on stereo, 5.1 and 7.1 buses, each channel
+    its own signal; costVsStereo is a whole bus block against a stereo one.
+    "bus/7.1/groups" times the same bus as separate stereo and mono engines.
+
+  ==============================================================================
+*/
+
+#include "AetherBenchSuites.h"
+#include "AetherBusEngine.h"
+#include "AetherDSP.h"
+
+namespace aether
+{
+namespace bench
+{
+
+namespace
+{
+
+/** Steps through a looping test signal one block at a time. */
+struct SignalSource
+{
+    SignalSource(const Options& options, int numChannels)
+        : signal(makeTestSignal(options.sampleRate, (int)options.sampleRate)),
+          block(numChannels, options.blockSize)
+    {
+    }
+
+    /** Refills the block from the signal and returns it. */
+    juce::AudioBuffer<float>& next()
+    {
+        const int n = block.getNumSamples();
+        if (position + n > (int)signal.size())
+            position = 0;
+
+        for (int ch = 0; ch < block.getNumChannels(); ++ch)
+            block.copyFrom(ch, 0, signal.data() + position, n);
+
+        position += n;
+        return block;
+    }
+
+    std::vector<float> signal;
+    juce::AudioBuffer<float> block;
+    int position = 0;
+};
+
+juce::dsp::ProcessSpec makeSpec(const Options& options, int numChannels)
+{
+    return { options.sampleRate, (juce::uint32)options.blockSize, (juce::uint32)numChannels };
+}
+
+const char* algoName(DistortionAlgo a)
+{
+    static const char* names[] = { "None", "SoftClip", "HardClip", "SineFold", "TriangleWarp", "BitCrush",
+                                   "SampleReduce", "AsymSaturation", "Rectify", "Tanh", "SoftFold", "Chebyshev" };
+    return names[(int)a];
+}
+
+void benchDistortion(Report& report, const Options& options)
+{
+    for (int a = 0; a < (int)DistortionAlgo::Count; ++a)
+    {
+        for (int stages = 1; stages <= 12; ++stages)
+        {
+            const auto algo = (DistortionAlgo)a;
+            const std::string name = std::string("distortion/") + algoName(algo) + "/stages" + std::to_string(stages);
+            if (! report.wants(name)) continue;
+
+            AetherDistortion<float> distortion;
+            distortion.prepare(makeSpec(options, 1));
+            SignalSource source(options, 1);
+
+            report.add(measure("modules", name, 1, options, [&]
+            {
+                auto* x = source.next().getWritePointer(0);
+                for (int i = 0; i < options.blockSize; ++i)
+                    x[i] = distortion.processSample(x[i], 0.6f, 0.2f, algo, algo, stages);
+                consume(x[options.blockSize - 1]);
+            }));
+        }
+    }
+}
+
+void benchFilter(Report& report, const Options& options)
+{
+    using Type = AetherFilter<float>::FilterType;
+
+    for (auto type : { Type::Morph, Type::Formant })
+    {
+        // Coefficients once per block (static) and once per sample (the engine's worst case)
+        for (int perSample = 0; perSample < 2; ++perSample)
+        {
+            const std::string name = std::string("filter/") + (type == Type::Morph ? "Morph" : "Formant")
+                                   + (perSample ? "/modulated" : "/static");
+            if (! report.wants(name)) continue;
+
+            AetherFilter<float> filter;
+            filter.prepare(makeSpec(options, 1));
+            filter.setType(type);
+            filter.setParams(1200.0f, 0.6f, 0.4f);
+            SignalSource source(options, 1);
+            float phase = 0.0f;
+
+            report.add(measure("modules", name, 1, options, [&]
+            {
+                auto* x = source.next().getWritePointer(0);
+                for (int i = 0; i < options.blockSize; ++i)
+                {
+                    if (perSample)
+                    {
+                        phase += 1.0e-4f;
+                        filter.setParams(800.0f + 600.0f * std::sin(phase), 0.6f, 0.4f);
+                    }
+                    x[i] = filter.processSample(x[i]);
+                }
+                consume(x[options.blockSize - 1]);
+            }));
+        }
+    }
+}
+
+void benchResonator(Report& report, const Options& options)
+{
+    for (float plasma : { 0.0f, 0.7f })
+    {
+        const std::string name = std::string("resonator/") + (plasma > 0.0f ? "plasma" : "clean");
+        if (! report.wants(name)) continue;
+
+        AetherResonator<float> resonator;
+        resonator.prepare(makeSpec(options, 1));
+        SignalSource source(options, 1);
+
+        report.add(measure("modules", name, 1, options, [&]
+        {
+            auto* x = source.next().getWritePointer(0);
+            for (int i = 0; i < options.blockSize; ++i)
+                x[i] = resonator.processSample(x[i], 0.6f, 40.0f, plasma);
+            consume(x[options.blockSize - 1]);
+        }));
+    }
+}
+
+void benchDimension(Report& report, const Options& options)
+{
+    const std::string name = "dimension/width1";
+    if (! report.wants(name)) return;
+
+    AetherDimension dimension;
+    dimension.prepare(makeSpec(options, 2));
+    SignalSource source(options, 2);
+
+    report.add(measure("modules", name, 2, options, [&]
+    {
+        auto& block = source.next();
+        auto* l = block.getWritePointer(0);
+        auto* r = block.getWritePointer(1);
+        for (int i = 0; i < options.blockSize; ++i)
+            dimension.process(l[i], r[i], 1.0f);
+        consume(l[options.blockSize - 1] + r[options.blockSize - 1]);
+    }));
+}
+
+void benchNoise(Report& report, const Options& options)
+{
+    using Type = AetherNoise<float>::NoiseType;
+    const std::pair<Type, const char*> types[] = {
+        { Type::White, "White" }, { Type::Pink, "Pink" }, { Type::Crackle, "Crackle" }, { Type::Custom, "Custom" }
+    };
+
+    for (auto& t : types)
+    {
+        const std::string name = std::string("noise/") + t.second;
+        if (! report.wants(name)) continue;
+
+        AetherNoise<float> noise;
+        noise.prepare(options.sampleRate);
+
+        // Custom plays a loaded sample: give it one second of the test signal
+        juce::AudioBuffer<float> customSample;
+        if (t.first == Type::Custom)
+        {
+            auto sample = makeTestSignal(options.sampleRate, (int)options.sampleRate, 7);
+            customSample.setSize(2, (int)sample.size());
+            customSample.copyFrom(0, 0, sample.data(), (int)sample.size());
+            customSample.copyFrom(1, 0, sample.data(), (int)sample.size());
+            noise.setCustomSample(&customSample);
+        }
+
+        SignalSource source(options, 2);
+
+        report.add(measure("modules", name, 2, options, [&]
+        {
+            auto& block = source.next();
+            auto* l = block.getWritePointer(0);
+            auto* r = block.getWritePointer(1);
+            for (int i = 0; i < options.blockSize; ++i)
+                noise.process(l[i], r[i], 0.5f, 0.5f, t.first, 1.0f);
+            consume(l[options.blockSize - 1] + r[options.blockSize - 1]);
+        }));
+    }
+}
+
+void benchCrossover(Report& report, const Options& options)
+{
+    const std::string name = "crossover/lr4";
+    if (! report.wants(name)) return;
+
+    AetherCrossover<float> crossover;
+    crossover.prepare(makeSpec(options, 1));
+    crossover.setCutoff(150.0f);
+    SignalSource source(options, 1);
+    std::vector<float> low((size_t)options.blockSize);
+
+    report.add(measure("modules", name, 1, options, [&]
+    {
+        auto* x = source.next().getWritePointer(0);
+        for (int i = 0; i < options.blockSize; ++i)
+            crossover.process(x[i], low[(size_t)i], x[i]);
+        consume(x[options.blockSize - 1] + low[(size_t)options.blockSize - 1]);
+    }));
+}
+
+/** The engine's up/down pair round trip, in tiles as processTile() calls it. Mono is the mono engine's one-lane path. */
+void benchOversamplerCase(Report& report, const Options& options, int channels, int factor, OversamplingFilter filter)
+{
+    const std::string name = "oversampler/" + std::to_string(factor) + "x/"
+                           + (filter == OversamplingFilter::PolyphaseIIR ? "iir" : "fir")
+                           + (channels == 1 ? "/mono" : "");
+    if (! report.wants(name)) return;
+
+    AetherOversampler<float> oversampler;
+    oversampler.prepare(AETHER_TILE_SIZE, channels);
+    oversampler.setConfiguration(factor, filter);
+    SignalSource source(options, channels);
+
+    report.add(measure("modules", name, channels, options, [&]
+    {
+        auto& block = source.next();
+        auto* l = block.getWritePointer(0);
+        auto* r = channels == 2 ? block.getWritePointer(1) : nullptr;
+
+        for (int start = 0; start < options.blockSize; start += AETHER_TILE_SIZE)
+        {
+            const int n = juce::jmin(AETHER_TILE_SIZE, options.blockSize - start);
+            oversampler.processUp(l + start, r != nullptr ? r + start : nullptr, n);
+            oversampler.processDown(l + start, r != nullptr ? r + start : nullptr, n);
+        }
+
+        consume(l[options.blockSize - 1]);
+    }));
+}
+
+void benchOversampler(Report& report, const Options& options)
+{
+    for (int channels : { 2, 1 })
+        for (int factor : { 2, 4, 8 })
+            for (auto filter : { OversamplingFilter::PolyphaseIIR, OversamplingFilter::LinearPhaseFIR })
+                benchOversamplerCase(report, options, channels, factor, filter);
+}
+
+/** A busy but stable patch: every stage on, resonator loop well below self-oscillation. */
+ParameterSnapshot makeEngineParams()
+{
+    ParameterSnapshot p;
+    p.drive = 0.6f;
+    p.fold = 0.3f;
+    p.stages = 4;
+    p.fbAmount = 0.5f;
+    p.fbTime = 40.0f;
+    p.scramble = 0.4f;
+    p.width = 0.8f;
+    p.squeeze = 0.3f;
+    p.noiseLevel = 0.1f;
+    return p;
+}
+
+template <int NumChannels>
+void benchEngine(Report& report, const Options& options, EngineQuality quality, const char* qualityName)
+{
+    const std::string name = std::string("engine/") + (NumChannels == 2 ? "stereo/" : "mono/") + qualityName;
+    if (! report.wants(name)) return;
+
+    auto engine = std::make_unique<AetherEngine<float, NumChannels>>();
+    engine->prepare(makeSpec(options, NumChannels));
+    engine->setQuality(quality);
+    const auto params = makeEngineParams();
+    SignalSource source(options, NumChannels);
+
+    report.add(measure("modules", name, NumChannels, options, [&]
+    {
+        auto& block = source.next();
+        engine->process(block, params);
+        consume(block.getSample(0, options.blockSize - 1));
+    }));
+}
+
+/** One signal per channel: a different seed and start point, so no two channels are alike. */
+struct BusSource
+{
+    BusSource(const Options& options, int numChannels)
+        : block(numChannels, options.blockSize)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+            signals.push_back(makeTestSignal(options.sampleRate, (int)options.sampleRate, (uint32_t)ch + 1));
+    }
+
+    juce::AudioBuffer<float>& next()
+    {
+        const int n = block.getNumSamples();
+        const int length = (int)signals[0].size();
+        if (position + n > length)
+            position = 0;
+
+        for (int ch = 0; ch < block.getNumChannels(); ++ch)
+        {
+            const int offset = (position + ch * length / 8) % (length - n);
+            block.copyFrom(ch, 0, signals[(size_t)ch].data() + offset, n);
+        }
+
+        position += n;
+        return block;
+    }
+
+    std::vector<std::vector<float>> signals;
+    juce::AudioBuffer<float> block;
+    int position = 0;
+};
+
+/** Adds the stereo-relative cost of a bus result; stereoNs is the stereo case's per-sample time. */
+void addBus(Report& report, Result result, double stereoNs)
+{
+    result.metrics.push_back({ "costVsStereo", result.nsPerSample * result.channels / (stereoNs * 2.0) });
+    report.add(result);
+}
+
+Result measureBus(const Options& options, const std::string& name, const juce::AudioChannelSet& layout)
+{
+    const int channels = layout.size();
+    auto engine = std::make_unique<AetherBusEngine>();
+    engine->prepare(makeSpec(options, channels), layout);
+    const auto params = makeEngineParams();
+    BusSource source(options, channels);
+
+    return measure("modules", name, channels, options, [&]
+    {
+        auto& block = source.next();
+        engine->process(block, params);
+        consume(block.getSample(channels - 1, options.blockSize - 1));
+    });
+}
+
+/** 7.1 the way separate engines would run it: three stereo pairs, centre and LFE alone. */
+Result measureBusGroups(const Options& options, const std::string& name)
+{
+    constexpr int channels = 8;
+    std::unique_ptr<AetherEngine<float, 2>> pairs[3];
+    std::unique_ptr<AetherEngine<float, 1>> singles[2];
+
+    for (auto& e : pairs)
+    {
+        e = std::make_unique<AetherEngine<float, 2>>();
+        e->prepare(makeSpec(options, 2));
+    }
+    for (auto& e : singles)
+    {
+        e = std::make_unique<AetherEngine<float, 1>>();
+        e->prepare(makeSpec(options, 1));
+    }
+
+    const auto params = makeEngineParams();
+    BusSource source(options, channels);
+
+    return measure("modules", name, channels, options, [&]
+    {
+        auto& block = source.next();
+        auto* const* data = block.getArrayOfWritePointers();
+
+        // JUCE 7.1 order: L R C LFE Ls Rs Lss Rss
+        const int pairChannels[3][2] = { { 0, 1 }, { 4, 5 }, { 6, 7 } };
+        for (int g = 0; g < 3; ++g)
+        {
+            float* view[] = { data[pairChannels[g][0]], data[pairChannels[g][1]] };
+            juce::AudioBuffer<float> buffer(view, 2, options.blockSize);
+            pairs[g]->process(buffer, params);
+        }
+        for (int g = 0; g < 2; ++g)
+        {
+            float* view[] = { data[2 + g] };
+            juce::AudioBuffer<float> buffer(view, 1, options.blockSize);
+            singles[g]->process(buffer, params);
+        }
+
+        consume(block.getSample(channels - 1, options.blockSize - 1));
+    });
+}
+
+void benchBus(Report& report, const Options& options)
+{
+    const bool any = report.wants("bus/stereo") || report.wants("bus/5.1")
+                  || report.wants("bus/7.1") || report.wants("bus/7.1/groups");
+    if (! any) return;
+
+    // Every case is relative to stereo, so stereo is timed even when filtered out
+    const auto stereo = measureBus(options, "bus/stereo", juce::AudioChannelSet::stereo());
+    if (report.wants("bus/stereo")) addBus(report, stereo, stereo.nsPerSample);
+
+    if (report.wants("bus/5.1"))
+        addBus(report, measureBus(options, "bus/5.1", juce::AudioChannelSet::create5point1()), stereo.nsPerSample);
+    if (report.wants("bus/7.1"))
+        addBus(report, measureBus(options, "bus/7.1", juce::AudioChannelSet::create7point1()), stereo.nsPerSample);
+    if (report.wants("bus/7.1/groups"))
+        addBus(report, measureBusGroups(options, "bus/7.1/groups"), stereo.nsPerSample);
+}
+
+} // namespace
+
+void runModuleSuite(Report& report, const Options& options)
+{
+    benchDistortion(report, options);
+    benchFilter(report, options);
+    benchResonator(report, options);
+    benchDimension(report, options);
+    benchNoise(report, options);
+    benchCrossover(report, options);
+    benchOversampler(report, options);
+
+    benchEngine<1>(report, options, EngineQuality::High, "high");
+    benchEngine<2>(report, options, EngineQuality::High, "high");
+    benchEngine<2>(report, options, EngineQuality::Eco, "eco");
+    benchBus(report, options);
+}
+
+} // namespace bench
+} // namespace aether
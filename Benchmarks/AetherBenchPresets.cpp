@@ -0,0 +1,128 @@
+/*
+  ==============================================================================
+
+    AetherBenchPresets.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    "presets" suite: each factory preset in a fresh headless
+    AetherAudioProcessor, playing the corpus (sweep, drums, noise, silence)
+    back to back at 44.1, 48 and 96 kHz and block sizes 32 to 2048.
+
+    Every processBlock() is timed on its own. A result reports the average
+    and p99 block cost, and both as a share of the block's real-time budget.
+    --rate, --block and --seconds do not apply here; --corpus sets the
+    length of each corpus signal and --filter narrows the grid by name
+    (e.g. "FURNACE", "/96k/", "/b64").
+
+  ==============================================================================
+*/
+
+#include "AetherBenchSuites.h"
+#include "AetherBenchCorpus.h"
+#include "PluginProcessor.h"
+#include <juce_gui_basics/juce_gui_basics.h>
+
+namespace aether
+{
+namespace bench
+{
+
+namespace
+{
+
+constexpr double presetRates[] = { 44100.0, 48000.0, 96000.0 };
+constexpr int presetBlockSizes[] = { 32, 64, 128, 256, 512, 1024, 2048 };
+
+std::string rateName(double rate)
+{
+    char text[16];
+    std::snprintf(text, sizeof(text), "%gk", rate / 1000.0);
+    return text;
+}
+
+} // namespace
+
+void runPresetSuite(Report& report, const Options& options)
+{
+    // The APVTS needs a message manager even with no editor
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    using Clock = std::chrono::steady_clock;
+
+    const auto presets = AetherPresets::getFactoryPresets();
+
+    for (double rate : presetRates)
+    {
+        const auto corpus = makeCorpus(rate, options.corpusSeconds);
+
+        for (int blockSize : presetBlockSizes)
+        {
+            for (int p = 0; p < (int)presets.size(); ++p)
+            {
+                const std::string name = "presets/" + presets[(size_t)p].name.toStdString()
+                                       + "/" + rateName(rate) + "/b" + std::to_string(blockSize);
+                if (! report.wants(name)) continue;
+
+                auto processor = std::make_unique<AetherAudioProcessor>();
+                processor->setRateAndBufferSizeDetails(rate, blockSize);
+                processor->prepareToPlay(rate, blockSize);
+                processor->loadFactoryPreset(p);
+
+                const int numChannels = processor->getTotalNumOutputChannels();
+                juce::AudioBuffer<float> block(numChannels, blockSize);
+                juce::MidiBuffer midi;
+
+                // First block applies the preset load; it is not part of the corpus
+                block.clear();
+                processor->processBlock(block, midi);
+
+                std::vector<double> blockSeconds;
+                double total = 0.0;
+
+                for (auto& item : corpus)
+                {
+                    const int length = (int)item.samples.size();
+
+                    for (int start = 0; start + blockSize <= length; start += blockSize)
+                    {
+                        for (int ch = 0; ch < numChannels; ++ch)
+                            block.copyFrom(ch, 0, item.samples.data() + start, blockSize);
+
+                        const auto t0 = Clock::now();
+                        processor->processBlock(block, midi);
+                        const double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+
+                        consume(block.getSample(0, blockSize - 1));
+                        blockSeconds.push_back(seconds);
+                        total += seconds;
+                    }
+                }
+
+                if (blockSeconds.empty()) continue;
+
+                const double budget = blockSize / rate;
+                const double average = total / (double)blockSeconds.size();
+                const double p99 = percentile(blockSeconds, 99.0);
+
+                Result r;
+                r.suite = "presets";
+                r.name = name;
+                r.channels = numChannels;
+                r.nsPerSample = average * 1.0e9 / ((double)blockSize * numChannels);
+                r.samplesPerSecond = 1.0e9 / r.nsPerSample;
+                r.instancesPerCore = budget / average;
+                r.metrics = {
+                    { "avgBlockUs", average * 1.0e6 },
+                    { "p99BlockUs", p99 * 1.0e6 },
+                    { "avgLoadPercent", 100.0 * average / budget },
+                    { "p99LoadPercent", 100.0 * p99 / budget },
+                };
+                report.add(r);
+            }
+        }
+    }
+}
+
+} // namespace bench
+} // namespace aether
@@ -0,0 +1,233 @@
+/*
+  ==============================================================================
+
+    AetherBenchStress.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    "stress" suite: one headless processor under hostile automation, timing
+    every processBlock() to find the rare expensive blocks averages hide.
+
+    Per block, every continuous parameter jumps to a random value and each
+    switch or choice flips with a small probability (flipping them every
+    block would make every block a restart). On top of that, at random:
+    NaN and rail-level input (watchdog resets), factory preset loads, custom
+    noise swaps, engine resets and sample-rate changes. Everything is drawn
+    from --seed, so two runs with the same seed see the same sequence.
+
+    Reported: p50 / p99 / p99.9 / max block time, a log-spaced histogram,
+    the number of blocks over budget and the worst block after each event.
+
+  ==============================================================================
+*/
+
+#include "AetherBenchSuites.h"
+#include "AetherBenchCorpus.h"
+#include "PluginProcessor.h"
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <iterator>
+#include <limits>
+
+namespace aether
+{
+namespace bench
+{
+
+namespace
+{
+
+enum Event
+{
+    None,
+    NaN,
+    Rail,
+    Preset,
+    NoiseSwap,
+    Reset,
+    RateChange,
+    NumEvents
+};
+
+const char* eventNames[NumEvents] = { "none", "nan", "rail", "preset", "noiseSwap", "reset", "rateChange" };
+
+// Chance per block of each event (None takes the rest)
+constexpr double eventChance[NumEvents] = { 0.0, 0.005, 0.005, 0.002, 0.002, 0.001, 0.0005 };
+constexpr double discreteFlipChance = 0.02;
+
+constexpr double stressRates[] = { 44100.0, 48000.0, 88200.0, 96000.0 };
+
+// Histogram bucket upper edges in microseconds (the last bucket is open)
+constexpr double histogramEdges[] = { 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000 };
+
+double uniform(Random& random) { return (double)(random.next() >> 8) / 16777216.0; }
+
+Event drawEvent(Random& random)
+{
+    double u = uniform(random);
+    for (int e = 1; e < NumEvents; ++e)
+    {
+        if (u < eventChance[e]) return (Event)e;
+        u -= eventChance[e];
+    }
+    return None;
+}
+
+} // namespace
+
+void runStressSuite(Report& report, const Options& options)
+{
+    const std::string name = "stress/seed" + std::to_string(options.seed) + "/b" + std::to_string(options.blockSize);
+    if (! report.wants(name)) return;
+
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    using Clock = std::chrono::steady_clock;
+
+    Random random(options.seed);
+    const int blockSize = options.blockSize;
+    double rate = options.sampleRate;
+
+    auto processor = std::make_unique<AetherAudioProcessor>();
+    processor->setRateAndBufferSizeDetails(rate, blockSize);
+    processor->prepareToPlay(rate, blockSize);
+
+    const int numChannels = processor->getTotalNumOutputChannels();
+    const auto numPresets = (int)AetherPresets::getFactoryPresets().size();
+    const auto drums = makeDrumLoop(rate, (int)(rate * 4.0), options.seed);
+    int position = 0;
+
+    juce::AudioBuffer<float> block(numChannels, blockSize);
+    juce::MidiBuffer midi;
+
+    std::vector<double> blockSeconds;
+    double worstAfter[NumEvents] = {};
+    int eventCounts[NumEvents] = {};
+    int overBudget = 0;
+    double renderedSeconds = 0.0;
+
+    while (renderedSeconds < options.stressSeconds)
+    {
+        // --- Automation: what a host would deliver between two blocks ---
+        for (auto* parameter : processor->getParameters())
+        {
+            if (! parameter->isDiscrete())
+                parameter->setValueNotifyingHost((float)uniform(random));
+            else if (uniform(random) < discreteFlipChance)
+                parameter->setValueNotifyingHost((float)uniform(random));
+        }
+
+        // --- Input: looping drums, possibly poisoned ---
+        for (int ch = 0; ch < numChannels; ++ch)
+            block.copyFrom(ch, 0, drums.data() + position, blockSize);
+        position = position + 2 * blockSize > (int)drums.size() ? 0 : position + blockSize;
+
+        const Event event = drawEvent(random);
+        ++eventCounts[event];
+
+        switch (event)
+        {
+            case NaN:
+                block.setSample(0, (int)(random.next() % (uint32_t)blockSize), std::numeric_limits<float>::quiet_NaN());
+                break;
+
+            case Rail:
+                for (int ch = 0; ch < numChannels; ++ch)
+                    for (int i = 0; i < blockSize; ++i)
+                        block.setSample(ch, i, (i / 16) % 2 ? 8.0f : -8.0f);
+                break;
+
+            case Preset:
+                processor->loadFactoryPreset((int)(random.next() % (uint32_t)numPresets));
+                break;
+
+            case NoiseSwap:
+            {
+                auto noise = std::make_unique<juce::AudioBuffer<float>>(2, (int)(rate * 0.5));
+                for (int ch = 0; ch < 2; ++ch)
+                    for (int i = 0; i < noise->getNumSamples(); ++i)
+                        noise->setSample(ch, i, 0.5f * random.bipolar());
+                processor->loadCustomNoise(std::move(noise));
+                break;
+            }
+
+            case Reset:
+                processor->requestEngineReset();
+                break;
+
+            case RateChange:
+            {
+                // Hosts stop processing, re-prepare and carry on: the next block is the one timed
+                double newRate = rate;
+                while (newRate == rate)
+                    newRate = stressRates[random.next() % (uint32_t)std::size(stressRates)];
+
+                rate = newRate;
+                processor->releaseResources();
+                processor->setRateAndBufferSizeDetails(rate, blockSize);
+                processor->prepareToPlay(rate, blockSize);
+                break;
+            }
+
+            case None:
+            case NumEvents:
+                break;
+        }
+
+        const auto t0 = Clock::now();
+        processor->processBlock(block, midi);
+        const double seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+
+        consume(block.getSample(0, blockSize - 1));
+        blockSeconds.push_back(seconds);
+        worstAfter[event] = std::max(worstAfter[event], seconds);
+
+        const double budget = blockSize / rate;
+        if (seconds > budget) ++overBudget;
+        renderedSeconds += budget;
+    }
+
+    double total = 0.0;
+    for (double s : blockSeconds)
+        total += s;
+
+    Result r;
+    r.suite = "stress";
+    r.name = name;
+    r.channels = numChannels;
+    r.nsPerSample = total * 1.0e9 / ((double)blockSeconds.size() * blockSize * numChannels);
+    r.samplesPerSecond = 1.0e9 / r.nsPerSample;
+    r.instancesPerCore = renderedSeconds / total;
+
+    r.metrics.push_back({ "blocks", (double)blockSeconds.size() });
+    r.metrics.push_back({ "p50BlockUs", percentile(blockSeconds, 50.0) * 1.0e6 });
+    r.metrics.push_back({ "p99BlockUs", percentile(blockSeconds, 99.0) * 1.0e6 });
+    r.metrics.push_back({ "p999BlockUs", percentile(blockSeconds, 99.9) * 1.0e6 });
+    r.metrics.push_back({ "maxBlockUs", *std::max_element(blockSeconds.begin(), blockSeconds.end()) * 1.0e6 });
+    r.metrics.push_back({ "overBudgetBlocks", (double)overBudget });
+
+    for (int e = 1; e < NumEvents; ++e)
+    {
+        r.metrics.push_back({ std::string(eventNames[e]) + "Count", (double)eventCounts[e] });
+        r.metrics.push_back({ std::string(eventNames[e]) + "WorstUs", worstAfter[e] * 1.0e6 });
+    }
+
+    double lowerEdge = 0.0;
+    for (double edge : histogramEdges)
+    {
+        const auto count = std::count_if(blockSeconds.begin(), blockSeconds.end(), [&](double s)
+        {
+            return s * 1.0e6 > lowerEdge && s * 1.0e6 <= edge;
+        });
+        r.metrics.push_back({ "histUpTo" + std::to_string((int)edge) + "Us", (double)count });
+        lowerEdge = edge;
+    }
+
+    r.metrics.push_back({ "histAbove" + std::to_string((int)lowerEdge) + "Us",
+                          (double)std::count_if(blockSeconds.begin(), blockSeconds.end(),
+                                                [&](double s) { return s * 1.0e6 > lowerEdge; }) });
+
+    report.add(r);
+}
+
+} // namespace bench
+} // namespace aether
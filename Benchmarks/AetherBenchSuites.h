@@ -0,0 +1,39 @@
+/*
+  ==============================================================================
+
+    AetherBenchSuites.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    The aether_bench suites. Each one adds its cases to the report.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherBenchCommon.h"
+
+namespace aether
+{
+namespace bench
+{
+
+/** Every DSP class in isolation, then the whole engine. */
+void runModuleSuite(Report& report, const Options& options);
+
+/** Every factory preset through a headless AetherAudioProcessor, over the corpus, rates and block sizes. */
+void runPresetSuite(Report& report, const Options& options);
+
+/** Aliasing, SNR and THD+N of every distortion algorithm and oversampling setup, against its CPU cost. */
+void runAliasingSuite(Report& report, const Options& options);
+
+/** Per-instance heap and RSS, and how many instances render in real time together on a thread pool. */
+void runDensitySuite(Report& report, const Options& options);
+
+/** Randomised automation and fault injection: the processBlock() latency distribution, not the average. */
+void runStressSuite(Report& report, const Options& options);
+
+} // namespace bench
+} // namespace aether
@@ -0,0 +1,297 @@
+/*
+  ==============================================================================
+
+    AetherBusEngine.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Runs the engine on any main bus layout: mono, stereo, quad, 5.x, 7.x
+    or discrete channels.
+
+    Mono and stereo buses run AetherEngine<float, 1> / <float, 2>. Anything
+    wider runs one AetherLaneEngine with a lane per channel, so a 7.1 bus
+    is one pass of 8-lane vectors rather than four engines. The layout only
+    decides the units that share noise and width: each left/right pair
+    (front, surround, side, rear, ...), discrete channels paired in order,
+    every other channel alone. The LFE channel can instead skip the
+    crossover and high band and go straight through the sub saturation,
+    delayed to line up with the rest of the bus.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherDSP.h"
+#include "AetherLaneEngine.h"
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace aether
+{
+
+class AetherBusEngine
+{
+    // Defined ahead of their callers: a deduced return type must be seen before use
+
+    /** fn on the engine in use; before the first prepare() there is none, and fn's result is value-initialised. */
+    template <typename Fn>
+    auto forEngine(Fn&& fn)
+    {
+        using Result = decltype(fn(*mono));
+        if (lanes != nullptr) return fn(*lanes);
+        if (pair != nullptr) return fn(*pair);
+        if (mono != nullptr) return fn(*mono);
+        return Result();
+    }
+
+    template <typename Fn>
+    auto forEngine(Fn&& fn) const
+    {
+        using Result = decltype(fn(std::as_const(*mono)));
+        if (lanes != nullptr) return fn(std::as_const(*lanes));
+        if (pair != nullptr) return fn(std::as_const(*pair));
+        if (mono != nullptr) return fn(std::as_const(*mono));
+        return Result();
+    }
+
+public:
+    static constexpr int maxChannels = AetherLaneEngine::maxLanes;
+    static constexpr int tileSize = AetherEngine<float>::tileSize;
+
+    /**
+     * Message thread. Prepares the engine for `layout`; a layout that does not
+     * match spec.numChannels is treated as discrete.
+     */
+    void prepare(const juce::dsp::ProcessSpec& spec, const juce::AudioChannelSet& layout)
+    {
+        numChannels = juce::jlimit(1, maxChannels, (int)spec.numChannels);
+        const auto units = buildUnits(layout.size() == numChannels ? layout : juce::AudioChannelSet::discreteChannels(numChannels));
+
+        auto engineSpec = spec;
+        engineSpec.numChannels = (juce::uint32)numChannels;
+
+        // Keep an engine of the same kind: re-preparing is cheaper than reallocating
+        if (numChannels == 1)
+        {
+            if (mono == nullptr) mono = std::make_unique<AetherEngine<float, 1>>();
+            pair.reset();
+            lanes.reset();
+            mono->prepare(engineSpec);
+        }
+        else if (numChannels == 2 && units.size() == 1)
+        {
+            if (pair == nullptr) pair = std::make_unique<AetherEngine<float, 2>>();
+            mono.reset();
+            lanes.reset();
+            pair->prepare(engineSpec);
+        }
+        else
+        {
+            if (lanes == nullptr) lanes = std::make_unique<AetherLaneEngine>();
+            mono.reset();
+            pair.reset();
+            lanes->prepare(engineSpec, units);
+        }
+
+        // An engine built by this prepare() has not seen the current buffer yet
+        forEngine([this](auto& e) { e.setCustomNoise(customNoise.get()); });
+        setHealthMonitor(health);
+        setProfiler(profiler);
+
+        lfeSub.prepare(spec.sampleRate, tileSize, 0.02, ParameterRamp::Shape::Linear);
+        lfeDrive.prepare(spec.sampleRate, tileSize, 0.02, ParameterRamp::Shape::Linear);
+        lfeDelay.prepare(1, getMaxLatencySamples());
+        lfePrimed = false;
+    }
+
+    void setQuality(EngineQuality q)      { forEngine([q](auto& e) { e.setQuality(q); }); }
+    void setLinearPhase(bool on)          { forEngine([on](auto& e) { e.setLinearPhase(on); }); }
+    void setLinearCrossover(bool on)      { forEngine([on](auto& e) { e.setLinearCrossover(on); }); }
+    void setTier(int t)                   { forEngine([t](auto& e) { e.setTier(t); }); }
+
+    void reset()
+    {
+        forEngine([](auto& e) { e.reset(); });
+        lfeDelay.reset();
+    }
+
+    /** Not while processing, after prepare(). Each pair or lone channel gets its own noise sequence (seed, seed + 2, ...). */
+    void setRandomSeed(juce::int64 seed)
+    {
+        forEngine([seed](auto& e) { e.setRandomSeed(seed); });
+    }
+
+    /** Not while processing. The engine reports its events to `h`. */
+    void setHealthMonitor(HealthMonitor* h)
+    {
+        health = h;
+        forEngine([h](auto& e) { e.setHealthMonitor(h, 0); });
+    }
+
+    /** Not while processing. The engine reports to `p`. */
+    void setProfiler(StageProfiler* p)
+    {
+        profiler = p;
+        forEngine([p](auto& e) { e.setProfiler(p, 0); });
+    }
+
+    int getTier() const               { return forEngine([](auto& e) { return e.getTier(); }); }
+    int getLatencySamples() const     { return forEngine([](auto& e) { return e.getLatencySamples(); }); }
+    int getMaxLatencySamples() const  { return forEngine([](auto& e) { return e.getMaxLatencySamples(); }); }
+    bool isSleeping() const           { return forEngine([](auto& e) { return e.isSleeping(); }); }
+
+    /**
+     * Audio thread only. Takes ownership of newBuffer, which every channel plays,
+     * and returns the previous one for the caller to free off the audio thread.
+     */
+    juce::AudioBuffer<float>* swapCustomNoise(juce::AudioBuffer<float>* newBuffer)
+    {
+        auto* previous = customNoise.release();
+        customNoise.reset(newBuffer);
+        forEngine([newBuffer](auto& e) { e.setCustomNoise(newBuffer); });
+        return previous;
+    }
+
+    int getLfeChannel() const { return lfeChannel; }
+
+    void process(juce::AudioBuffer<float>& buffer, const ParameterSnapshot& params)
+    {
+        const int numSamples = buffer.getNumSamples();
+        const int available = juce::jmin(numChannels, buffer.getNumChannels());
+        const bool lfeDirect = lfeChannel >= 0 && lfeChannel < available && params.lfeToSub;
+
+        if (lanes != nullptr)
+        {
+            // The LFE lane idles while it takes the direct path: fed silence, it decays
+            // like any quiet channel and rejoins the bus from there
+            float* channels[maxChannels] = {};
+            for (int ch = 0; ch < available; ++ch)
+                channels[ch] = lfeDirect && ch == lfeChannel ? nullptr : buffer.getWritePointer(ch);
+
+            lanes->process(channels, numSamples, params);
+        }
+        else if (available == numChannels && !lfeDirect)
+        {
+            float* channels[] = { buffer.getWritePointer(0), numChannels > 1 ? buffer.getWritePointer(1) : nullptr };
+            juce::AudioBuffer<float> view(channels, numChannels, numSamples);
+
+            if (pair != nullptr) pair->process(view, params);
+            else mono->process(view, params);
+        }
+
+        // A mono LFE bus restarts clean whenever its engine is switched back in
+        if (lfeDirect != lfeWasDirect && mono != nullptr)
+            mono->reset();
+        lfeWasDirect = lfeDirect;
+
+        if (lfeDirect)
+            processLfe(buffer.getWritePointer(lfeChannel), numSamples, params);
+    }
+
+private:
+    /** Pairs named left/right channels, pairs discrete channels in order, and leaves the rest alone. */
+    std::vector<AetherLaneEngine::Unit> buildUnits(const juce::AudioChannelSet& layout)
+    {
+        using CT = juce::AudioChannelSet::ChannelType;
+        static constexpr CT pairs[][2] = {
+            { CT::left, CT::right },
+            { CT::leftSurround, CT::rightSurround },
+            { CT::leftSurroundSide, CT::rightSurroundSide },
+            { CT::leftSurroundRear, CT::rightSurroundRear },
+            { CT::leftCentre, CT::rightCentre },
+            { CT::wideLeft, CT::wideRight },
+        };
+
+        const int size = juce::jmin(maxChannels, layout.size());
+        std::array<bool, maxChannels> used {};
+        std::vector<AetherLaneEngine::Unit> units;
+
+        for (auto& p : pairs)
+        {
+            const int l = layout.getChannelIndexForType(p[0]);
+            const int r = layout.getChannelIndexForType(p[1]);
+            if (l >= 0 && r >= 0 && l < size && r < size)
+            {
+                units.push_back({ l, r });
+                used[(size_t)l] = used[(size_t)r] = true;
+            }
+        }
+
+        const int lfe = layout.getChannelIndexForType(CT::LFE);
+        lfeChannel = lfe < size ? lfe : -1;
+
+        const bool discrete = layout.isDiscreteLayout();
+        for (int ch = 0; ch < size; ++ch)
+        {
+            if (used[(size_t)ch]) continue;
+            used[(size_t)ch] = true;
+
+            int partner = -1;
+            if (discrete && ch + 1 < size)
+            {
+                partner = ch + 1;
+                used[(size_t)partner] = true;
+            }
+
+            units.push_back({ ch, partner });
+        }
+
+        return units;
+    }
+
+    /** LFE straight into the sub saturation: no crossover, no high band. */
+    void processLfe(float* data, int numSamples, const ParameterSnapshot& params)
+    {
+        if (lfePrimed)
+        {
+            lfeSub.setTarget(params.sub);
+            lfeDrive.setTarget(params.drive);
+        }
+        else
+        {
+            lfeSub.reset(params.sub);
+            lfeDrive.reset(params.drive);
+            lfePrimed = true;
+        }
+
+        for (int start = 0; start < numSamples; start += tileSize)
+        {
+            const int n = juce::jmin(tileSize, numSamples - start);
+            lfeSub.render(n);
+            lfeDrive.render(n);
+
+            for (int s = 0; s < n; ++s)
+            {
+                float l = data[start + s], r = l;
+                lfeSubProcessor.process(l, r, lfeSub.get(s), lfeDrive.get(s));
+                data[start + s] = std::tanh(l); // Same output stage as the engine
+            }
+        }
+
+        // Same latency as the engine, so the LFE stays in time with the other channels
+        lfeDelay.setDelay(getLatencySamples());
+        lfeDelay.process(data, 0, numSamples);
+    }
+
+    int numChannels = 2;
+    std::unique_ptr<AetherEngine<float, 1>> mono;
+    std::unique_ptr<AetherEngine<float, 2>> pair;
+    std::unique_ptr<AetherLaneEngine> lanes;
+
+    std::unique_ptr<juce::AudioBuffer<float>> customNoise; // Shared by every channel
+    HealthMonitor* health = nullptr;
+    StageProfiler* profiler = nullptr;
+    int lfeChannel = -1; // Bus channel of the LFE, -1 if the layout has none
+    bool lfeWasDirect = false;
+
+    AetherSubProcessor<float> lfeSubProcessor;
+    ParameterRamp lfeSub, lfeDrive;
+    bool lfePrimed = false;
+    DelayCompensation<float> lfeDelay;
+};
+
+} // namespace aether
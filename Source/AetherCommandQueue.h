@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    AetherCommandQueue.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Bounded lock-free SPSC queue plus the typed engine commands that travel
+    through it.
+
+    The message thread posts EngineCommands, the audio thread drains them at
+    the top of processBlock. Anything the audio thread displaces (an old noise
+    buffer, a released preset snapshot) is pushed onto a second queue going
+    the other way, so allocation and freeing both stay on the message thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherCommon.h"
+#include "AetherPresets.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace aether
+{
+
+template <typename T, int Capacity>
+class SpscQueue
+{
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscQueue capacity must be a power of two");
+
+    /** Producer only. Returns false if the queue is full. */
+    bool push(const T& item)
+    {
+        auto w = writePos.load(std::memory_order_relaxed);
+        if (w - readPos.load(std::memory_order_acquire) >= (uint32_t)Capacity)
+            return false;
+
+        slots[w & mask] = item;
+        writePos.store(w + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Consumer only. Returns false if the queue is empty. */
+    bool pop(T& item)
+    {
+        auto r = readPos.load(std::memory_order_relaxed);
+        if (r == writePos.load(std::memory_order_acquire))
+            return false;
+
+        item = slots[r & mask];
+        readPos.store(r + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Producer side: a lower bound on how many pushes will succeed. */
+    int getFreeSpace() const
+    {
+        return Capacity - (int)(writePos.load(std::memory_order_relaxed) - readPos.load(std::memory_order_acquire));
+    }
+
+private:
+    static constexpr uint32_t mask = (uint32_t)Capacity - 1;
+
+    // Producer and consumer indices live on separate cache lines
+    alignas(64) std::atomic<uint32_t> writePos { 0 };
+    alignas(64) std::atomic<uint32_t> readPos { 0 };
+    alignas(64) std::array<T, Capacity> slots {};
+};
+
+/**
+ * EngineCommand: non-parameter actions for the audio thread.
+ * Payload pointers are owned by whoever currently holds the command.
+ */
+struct EngineCommand
+{
+    enum class Type
+    {
+        SwapNoise,     // noise: new custom noise buffer (nullptr clears it)
+        Reset,         // clear all engine state
+        BeginSnapshot, // snapshot: values that override the APVTS until EndSnapshot
+        EndSnapshot,
+        SetQuality     // quality
+    };
+
+    Type type = Type::Reset;
+    juce::AudioBuffer<float>* noise = nullptr;
+    const PresetData* snapshot = nullptr;
+    EngineQuality quality = EngineQuality::High;
+
+    /** Frees whatever payload this command carries. Message thread only. */
+    void freePayload()
+    {
+        delete noise;
+        delete snapshot;
+        noise = nullptr;
+        snapshot = nullptr;
+    }
+};
+
+using EngineCommandQueue = SpscQueue<EngineCommand, 64>;
+
+} // namespace aether
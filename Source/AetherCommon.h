@@ -3,6 +3,20 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <cmath>
 
+/**
+ * Internal tile size of AetherEngine (samples at the host rate).
+ * Host blocks of any size are processed in tiles of this length so the
+ * working set of every stage stays in L1/L2. Override from the build
+ * (e.g. -DAETHER_TILE_SIZE=128).
+ */
+#ifndef AETHER_TILE_SIZE
+ #define AETHER_TILE_SIZE 64
+#endif
+
+static_assert(AETHER_TILE_SIZE >= 16 && AETHER_TILE_SIZE <= 1024
+              && (AETHER_TILE_SIZE & (AETHER_TILE_SIZE - 1)) == 0,
+              "AETHER_TILE_SIZE must be a power of two in [16, 1024]");
+
 namespace aether
 {
 
@@ -41,6 +55,15 @@ enum class FilterMode
     Harmonic
 };
 
+/**
+ * Engine Quality: oversampling factor of the high band
+ */
+enum class EngineQuality
+{
+    High, // 4x
+    Eco   // 2x
+};
+
 // Helper for fast atan/tanh if needed later
 inline float fastTanh(float x)
 {
@@ -4,11 +4,20 @@
 #include "AetherDistortion.h"
 #include "AetherFilter.h"
 #include "AetherResonator.h"
-#include "AetherResonator.h"
 #include "AetherModulation.h"
 #include "AetherDimension.h"
 #include "AetherNoise.h"
+#include "AetherParameters.h"
+#include "AetherGovernor.h"
+#include "AetherKernels.h"
+#include "AetherOversampler.h"
+#include "AetherDelayCompensation.h"
+#include "AetherLinearPhaseCrossover.h"
+#include "AetherProfiler.h"
+#include "AetherHealth.h"
 #include <juce_dsp/juce_dsp.h> // Required for juce::dsp::StateVariableTPTFilter
+#include <cstring>
+#include <limits>
 
 namespace aether
 {
@@ -16,39 +25,155 @@ namespace aether
 // --- NEURO COMPONENTS ---
 
 // 4th Order Linkwitz-Riley Crossover (Matched Phase)
+// Same TPT state-variable topology as juce::dsp::StateVariableTPTFilter, but with
+// the state inline: JUCE keeps each filter's s1/s2 in its own heap vector, which
+// scattered eight small allocations per channel across the per-sample path.
 template <typename SampleType>
 class AetherCrossover
 {
 public:
+    /** One Butterworth section's coefficients; the LR4 runs two of them in series per band. */
+    struct Coefficients
+    {
+        SampleType g = 0, r2 = 0, h = 0;
+
+        void set(float frequency, double sampleRate)
+        {
+            // Linkwitz-Riley Q = 0.707 (Butterworth) cascaded
+            const double gd = std::tan(juce::MathConstants<double>::pi * frequency / sampleRate);
+            const double R2 = 1.0 / 0.707;
+
+            g = (SampleType)gd;
+            r2 = (SampleType)R2;
+            h = (SampleType)(1.0 / (1.0 + r2 * g + g * g));
+        }
+    };
+
+    /** One TPT state-variable step. Returns the highpass output; band and low pass through the references. */
+    static SampleType tick(SampleType x, const Coefficients& c, SampleType& s1, SampleType& s2, SampleType& yBP, SampleType& yLP)
+    {
+        const SampleType yHP = c.h * (x - s1 * (c.g + c.r2) - s2);
+
+        yBP = yHP * c.g + s1;
+        s1 = yHP * c.g + yBP;
+
+        yLP = yBP * c.g + s2;
+        s2 = yBP * c.g + yLP;
+
+        return yHP;
+    }
+
     void prepare(const juce::dsp::ProcessSpec& spec)
     {
-        lp1.prepare(spec); lp2.prepare(spec);
-        hp1.prepare(spec); hp2.prepare(spec);
-        lp1.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
-        lp2.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
-        hp1.setType(juce::dsp::StateVariableTPTFilterType::highpass);
-        hp2.setType(juce::dsp::StateVariableTPTFilterType::highpass);
+        sampleRate = spec.sampleRate;
+        setCutoff(frequency);
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto* f : { &lp1, &lp2, &hp1, &hp2 })
+            f->s1 = f->s2 = 0;
     }
 
-    void setCutoff(float frequency)
+    void setCutoff(float newFrequency)
     {
-        lp1.setCutoffFrequency(frequency); lp2.setCutoffFrequency(frequency);
-        hp1.setCutoffFrequency(frequency); hp2.setCutoffFrequency(frequency);
-        // Linkwitz-Riley Q = 0.707 (Butterworth) cascaded
-        lp1.setResonance(0.707f); lp2.setResonance(0.707f);
-        hp1.setResonance(0.707f); hp2.setResonance(0.707f);
+        frequency = newFrequency;
+        coeffs.set(frequency, sampleRate);
     }
 
     void process(SampleType input, SampleType& outLow, SampleType& outHigh)
     {
         // 4th Order LP = LP -> LP
-        outLow = lp2.processSample(0, lp1.processSample(0, input));
+        outLow = lp2.lowpass(lp1.lowpass(input, *this), *this);
         // 4th Order HP = HP -> HP
-        outHigh = hp2.processSample(0, hp1.processSample(0, input));
+        outHigh = hp2.highpass(hp1.highpass(input, *this), *this);
+    }
+
+private:
+    struct Section
+    {
+        SampleType s1 = 0, s2 = 0;
+
+        SampleType lowpass(SampleType x, const AetherCrossover& c)
+        {
+            SampleType yBP, yLP;
+            tick(x, c.coeffs, s1, s2, yBP, yLP);
+            return yLP;
+        }
+
+        SampleType highpass(SampleType x, const AetherCrossover& c)
+        {
+            SampleType yBP, yLP;
+            return tick(x, c.coeffs, s1, s2, yBP, yLP);
+        }
+    };
+
+    Section lp1, lp2, hp1, hp2;
+    Coefficients coeffs;
+    float frequency = 150.0f;
+    double sampleRate = 44100.0;
+};
+
+/**
+ * AetherCrossover over interleaved frames of up to maxLanes channels: one set
+ * of coefficients, the four sections' state per lane, so every lane runs in
+ * the same vector. Each lane matches its own AetherCrossover exactly.
+ */
+template <typename SampleType>
+class AetherLaneCrossover
+{
+public:
+    static constexpr int maxLanes = 8;
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        setCutoff(frequency);
+        reset();
+    }
+
+    void reset()
+    {
+        std::memset(s1, 0, sizeof(s1));
+        std::memset(s2, 0, sizeof(s2));
+    }
+
+    void setCutoff(float newFrequency)
+    {
+        frequency = newFrequency;
+        coeffs.set(frequency, sampleRate);
+    }
+
+    /** Splits numSamples frames of Lanes channels: the lows into low, the highs in place. */
+    template <int Lanes>
+    void process(SampleType* x, SampleType* low, int numSamples)
+    {
+        using Crossover = AetherCrossover<SampleType>;
+        enum { lp1, lp2, hp1, hp2 };
+
+        for (int s = 0; s < numSamples; ++s)
+        {
+            SampleType* frame = x + s * Lanes;
+
+            for (int k = 0; k < Lanes; ++k)
+            {
+                SampleType yBP, yLP, unused;
+                Crossover::tick(frame[k], coeffs, s1[lp1][k], s2[lp1][k], yBP, yLP);
+                Crossover::tick(yLP, coeffs, s1[lp2][k], s2[lp2][k], yBP, low[s * Lanes + k]);
+
+                const SampleType h = Crossover::tick(frame[k], coeffs, s1[hp1][k], s2[hp1][k], yBP, unused);
+                frame[k] = Crossover::tick(h, coeffs, s1[hp2][k], s2[hp2][k], yBP, unused);
+            }
+        }
     }
 
 private:
-    juce::dsp::StateVariableTPTFilter<SampleType> lp1, lp2, hp1, hp2;
+    // Sections lp1, lp2, hp1, hp2, then lanes
+    SampleType s1[4][maxLanes] {}, s2[4][maxLanes] {};
+    typename AetherCrossover<SampleType>::Coefficients coeffs;
+    float frequency = 150.0f;
+    double sampleRate = 44100.0;
 };
 
 // Clean Sub Processor (Mono Sum + Warmth)
@@ -72,64 +197,273 @@ public:
     }
 };
 
+/** Per-sample smoothing for every continuous engine parameter. */
+struct EngineRamps
+{
+    ParameterRamp drive, fold, cutoff, res, morph;
+    ParameterRamp fbAmount, fbTime, scramble;
+    ParameterRamp sub, squeeze, width;
+    ParameterRamp noiseLevel, noiseWidth;
+
+    template <typename Fn>
+    void forEach(Fn&& fn)
+    {
+        for (auto* r : { &drive, &fold, &cutoff, &res, &morph, &fbAmount, &fbTime, &scramble,
+                         &sub, &squeeze, &width, &noiseLevel, &noiseWidth })
+            fn(*r);
+    }
+
+    /** Message thread. Ramps render up to maxSamples per call. */
+    void prepare(double sampleRate, int maxSamples)
+    {
+        constexpr double rampSeconds = 0.02;
+        const auto lin = ParameterRamp::Shape::Linear;
+        const auto exp = ParameterRamp::Shape::Exponential;
+
+        forEach([&](ParameterRamp& r) { r.prepare(sampleRate, maxSamples, rampSeconds, lin); });
+
+        // Frequencies and times glide in ratio, not in Hz/ms
+        cutoff.prepare(sampleRate, maxSamples, rampSeconds, exp);
+        fbTime.prepare(sampleRate, maxSamples, rampSeconds, exp);
+
+        primed = false;
+    }
+
+    /** Block rate. Targets are set per block; each tile renders its slice of the ramp. */
+    void setTargets(const ParameterSnapshot& p)
+    {
+        auto apply = [&](ParameterRamp& r, float value)
+        {
+            if (primed) r.setTarget(value);
+            else r.reset(value); // First block after prepare: no glide from stale values
+        };
+
+        apply(drive, p.drive);
+        apply(fold, p.fold);
+        apply(cutoff, p.cutoff);
+        apply(res, p.res);
+        apply(morph, p.morph);
+        apply(fbAmount, p.fbAmount);
+        apply(fbTime, p.fbTime);
+        apply(scramble, p.scramble);
+        apply(sub, p.sub);
+        apply(squeeze, p.squeeze);
+        apply(width, p.width);
+        apply(noiseLevel, p.noiseLevel);
+        apply(noiseWidth, p.noiseWidth);
+
+        primed = true;
+    }
+
+    void render(int numSamples)
+    {
+        forEach([numSamples](ParameterRamp& r) { r.render(numSamples); });
+    }
+
+    bool primed = false;
+};
+
+/**
+ * Stages that can be skipped for a whole block. A stage is on while either
+ * end of its ramp is active, and every skipped stage is a pass-through at
+ * its "off" value, so skipping changes nothing but the cost.
+ */
+struct StagePlan
+{
+    bool noise = true;
+    bool fold = true;
+    bool resonator = true;
+    bool dimension = true; // AetherDimension bypasses itself at width <= 0.01
+    bool squeeze = true;
+
+    static StagePlan from(const EngineRamps& r)
+    {
+        StagePlan plan;
+        plan.noise = isOn(r.noiseLevel);
+        plan.fold = isOn(r.fold);
+        plan.resonator = isOn(r.fbAmount);
+        plan.dimension = isOn(r.width, 0.01f);
+        plan.squeeze = isOn(r.squeeze);
+        return plan;
+    }
+
+    static bool isOn(const ParameterRamp& r, float threshold = 0.0f)
+    {
+        return r.getCurrent() > threshold || r.getTarget() > threshold;
+    }
+};
+
 /**
  * AetherEngine: The Neuro-Bass Workstation (Split-Band Architecture)
+ *
+ * NumChannels is 1 or 2 and fixed at compile time, so the per-sample loops
+ * carry no channel-count tests. Wider buses run AetherLaneEngine, the same
+ * chain with every channel in a vector lane (see AetherBusEngine).
  */
-template <typename SampleType>
+template <typename SampleType, int NumChannels = 2>
 class AetherEngine
 {
+    static_assert(NumChannels == 1 || NumChannels == 2, "AetherEngine is mono or stereo");
+    static constexpr bool stereo = NumChannels == 2;
+
 public:
+    // Internal processing granularity (see AETHER_TILE_SIZE in AetherCommon.h)
+    static constexpr int tileSize = AETHER_TILE_SIZE;
+
     AetherEngine() = default;
 
     void prepare(const juce::dsp::ProcessSpec& spec)
     {
-        // 4x Oversampling (Factor 2: 2^2 = 4)
-        // Latency: Linear Phase is better for phase coherence with Sub, but adds latency.
-        // We use IIR for efficiency and acceptable phase characteristic for this effect.
-        oversampler.initProcessing(spec.maximumBlockSize);
-        oversampler.reset();
+        preparedSpec = spec;
+
+        // Everything below is sized by the tile, not by the host block:
+        // the host's maximumBlockSize no longer matters to the engine.
+        jassert((int)spec.numChannels == NumChannels);
+        highTile.setSize(NumChannels, tileSize);
+        lowTile.setSize(NumChannels, tileSize);
+        fluxTile.assign((size_t)tileSize * 4, 0.0f);
+        chaosTile.assign((size_t)tileSize * 4, 0.0f);
+        driveTile.assign((size_t)tileSize * 4, 0.0f);
+        tiltTile.assign((size_t)tileSize * 4, 0.0f);
+
+        // Oversampling: 4x (High) or 2x (Eco), IIR or linear-phase FIR. Every
+        // configuration is designed and allocated here, so setQuality() and
+        // setLinearPhase() never allocate on the audio thread.
+        oversampler.prepare(tileSize, NumChannels);
+        lowDelay.prepare(NumChannels, oversampler.getMaxLatencySamples());
 
-        // CRITICAL FIX: Components in the upsampled path (High Band) run at 4x sample rate.
-        // We must prepare them with the correct rate so filters/LFOs behave correctly.
+        // CRITICAL FIX: Components in the upsampled path (High Band) run at the oversampled rate.
+        // We prepare them at the highest rate first (sizes the dimension delay lines),
+        // then applyQuality() retunes them for the active factor.
         juce::dsp::ProcessSpec oversampledSpec = spec;
         oversampledSpec.sampleRate = spec.sampleRate * 4.0;
-        oversampledSpec.maximumBlockSize = spec.maximumBlockSize * 4; // Buffer grows by 4x
+        oversampledSpec.maximumBlockSize = (juce::uint32)tileSize * 4; // Tile grows by 4x
         
         // Prepare High-Band Chain with Oversampled Rate
-        distortion.prepare(oversampledSpec);
-        filter.prepare(oversampledSpec);
-        resonator.prepare(oversampledSpec);
+        filterL.prepare(oversampledSpec);
+        filterR.prepare(oversampledSpec);
+        resonatorL.prepare(oversampledSpec);
+        resonatorR.prepare(oversampledSpec);
         
         // Prepare Sub & Split (Run at native 1x rate)
         crossoverL.prepare(spec);
         crossoverR.prepare(spec);
+        linearCrossover.prepare(spec.sampleRate);
         
-        chaosLFO.prepare(spec.sampleRate); // LFOs stay at control rate (likely fine)
         chaosLFO.setParams(0.2f, AetherLFO::Waveform::Drift);
-        fluxFollower.prepare(spec.sampleRate);
-        fluxFollower.setParams(10.0f, 300.0f);
-        
-        fluxFollower.prepare(spec.sampleRate);
-        fluxFollower.setParams(10.0f, 300.0f);
         
         // NOISE GATE: Tight response (30ms release)
         noiseGateFollower.prepare(spec.sampleRate);
         noiseGateFollower.setParams(5.0f, 30.0f); 
         
-        // Fix: Dimension runs in oversampled loop, needs 4x rate for correct delay times
+        // Fix: Dimension runs in oversampled loop, needs the oversampled rate for correct delay times
         dimension.prepare(oversampledSpec);
         
         noiseGen.prepare(spec.sampleRate); // Noise is generated at 1x then upsampled naturally or injected?
         // Wait, noise is injected at 1x in process(), then split. So prepare(spec.sampleRate) is correct.
-        
-        numChannels = spec.numChannels;
-        
+
+        prepareRamps(spec);
+        applyQuality();
         reset();
     }
 
-    void setCustomNoise(const juce::AudioBuffer<float>& newBuffer)
+    /**
+     * Audio thread. Switches the oversampling factor of the high band.
+     * The high band restarts from silence, so expect a short gap in the highs.
+     */
+    void setQuality(EngineQuality newQuality)
     {
-        noiseGen.setCustomSample(newBuffer);
+        if (newQuality == quality) return;
+
+        quality = newQuality;
+        applyQuality();
+        reset();
+    }
+
+    EngineQuality getQuality() const { return quality; }
+
+    /**
+     * Audio thread. Linear-phase oversampling: the highs keep their phase
+     * against the sub, at the cost of getLatencySamples() of latency (the low
+     * band is delayed to match). Restarts from silence like setQuality().
+     */
+    void setLinearPhase(bool shouldBeLinear)
+    {
+        if (shouldBeLinear == linearPhase) return;
+
+        linearPhase = shouldBeLinear;
+        applyQuality();
+        reset();
+    }
+
+    bool isLinearPhase() const { return linearPhase; }
+
+    /**
+     * Audio thread. Splits the bands with a linear-phase FIR instead of the
+     * Linkwitz-Riley IIRs: transients keep their shape across the crossover,
+     * for another linearCrossover.getLatencySamples() of latency.
+     */
+    void setLinearCrossover(bool shouldBeLinear)
+    {
+        if (shouldBeLinear == useLinearCrossover) return;
+
+        useLinearCrossover = shouldBeLinear;
+        applyQuality();
+        reset();
+    }
+
+    bool isLinearCrossover() const { return useLinearCrossover; }
+
+    /** Output latency in samples: constant for given linear-phase settings, whatever the quality or tier. */
+    int getLatencySamples() const { return latencySamples; }
+
+    /** Largest value getLatencySamples() can report (for sizing dry-path compensation). */
+    int getMaxLatencySamples() const
+    {
+        return oversampler.getMaxLatencySamples() + linearCrossover.getLatencySamples();
+    }
+
+    /**
+     * Audio thread. Requests a governor tier (see QualityTier). The high band
+     * ducks out over a few ms, the tier is applied while it is silent and the
+     * band fades back in: a short dip in the highs instead of a click.
+     */
+    void setTier(int newTier)
+    {
+        pendingTier = juce::jlimit(0, QualityTier::numTiers - 1, newTier);
+    }
+
+    int getTier() const { return tierIndex; }
+
+    /**
+     * Not while processing. Makes the noise and the chaos LFO repeat exactly
+     * from here on (tests, offline comparisons). Unseeded engines start from a
+     * random seed, so two instances never share their noise.
+     */
+    void setRandomSeed(juce::int64 seed)
+    {
+        noiseGen.setSeed(seed);
+        chaosLFO.setSeed(seed + 1);
+    }
+
+    /** Audio thread only. Not owned: the caller keeps the buffer alive until it is replaced. */
+    void setCustomNoise(const juce::AudioBuffer<float>* buffer)
+    {
+        noiseGen.setCustomSample(buffer);
+    }
+
+    /** Not while processing. Watchdog, guard and sleep events go to `h` (nullptr: none), tagged with `group`. */
+    void setHealthMonitor(HealthMonitor* h, int group)
+    {
+        health = h;
+        healthGroup = group;
+    }
+
+    /** Not while processing. Stage timings go to `p` (nullptr: none), tagged with `group`. */
+    void setProfiler(StageProfiler* p, int group)
+    {
+        profiler = p;
+        profileGroup = group;
     }
 
     /**
@@ -144,18 +478,38 @@ public:
      * 1. Clears all filter states (history).
      * 2. Clears all delay buffers (silence).
      * 3. Resets DC blockers.
-     * 4. Resets the Oversampler (crucial).
+     * 4. Resets the Oversampler (crucial) and the low-band delay.
      * 
      * This turns a "Crash/Silence" event into a mere "Click" followed by recovery.
      */
     void reset()
     {
-        distortion.reset();
-        filter.reset();
-        resonator.reset();
+        filterL.reset();
+        filterR.reset();
+        resonatorL.reset();
+        resonatorR.reset();
         
         oversampler.reset();
+        lowDelay.reset();
+        linearCrossover.reset();
         
+        foldHoldL = 0; foldHoldR = 0; foldCounter = 0;
+        noiseGateFollower.reset();
+
+        // A NaN reaches these too: left alone, they would trip the watchdog again every block
+        crossoverL.reset();
+        crossoverR.reset();
+        fluxFollower.reset();
+        dimension.reset();
+
+        // Both sides are cleared, so they are in sync again
+        dualMono = false;
+        identicalSamples = 0;
+
+        // Wake up and restart the silence count
+        sleeping = false;
+        silentSamples = 0;
+
         // Clear DC States
         dcL_x1 = 0; dcL_y1 = 0;
         dcR_x1 = 0; dcR_y1 = 0;
@@ -167,20 +521,187 @@ public:
         // For now, the main culprits are the high band components.
     }
 
-    void process(juce::AudioBuffer<SampleType>& buffer, 
-                 float drive, float blend, int stages, 
-                 DistortionAlgo algoPos, DistortionAlgo algoNeg,
-                 float cutoff, float resonance, float morph,
-                 float fbAmount, float fbTimeMs, float scramble,
-                 float subLevel, float squeeze, double bpm,
-                 float width, float xoverHz, float fold, bool vowelMode,
-                 float noiseLevel, float noiseWidth, int noiseType)
+    // Anything below this peak (-100 dBFS) counts as silence for the sleep detector
+    static constexpr float silenceThreshold = 1.0e-5f;
+
+    /**
+     * Time for the output to decay below silenceThreshold after the input stops,
+     * or infinity while the resonator loop can sustain itself (fb * plasma drive >= 1).
+     * Message or audio thread: depends only on the snapshot.
+     */
+    static double computeTailSeconds(const ParameterSnapshot& p)
+    {
+        // Filters, oversampler and DC blocker settle well within this, and the
+        // linear-phase latencies (< 30 ms at any rate) fit inside it too
+        constexpr double baseTail = 0.05;
+        const double decayLoops = std::log((double)silenceThreshold); // Loops of gain g to fall 100 dB: ln(t) / ln(g)
+
+        double tail = baseTail;
+
+        // Resonator: small-signal loop gain is feedback times the plasma saturation drive
+        const double loopGain = (double)p.fbAmount * (1.0 + 0.5 * (double)p.scramble);
+        if (loopGain >= 1.0)
+            return std::numeric_limits<double>::infinity();
+
+        if (loopGain > 0.0)
+        {
+            const double loopSeconds = ((double)p.fbTime + 10.0) / 1000.0; // + worst-case plasma detune
+            tail += loopSeconds * decayLoops / std::log(loopGain);
+        }
+
+        // Dimension: four g = 0.5 all-passes in series (2 + 3 + 7 + 11 ms)
+        if (p.width > 0.0f)
+            tail += 0.023 * decayLoops / std::log(0.5);
+
+        return tail;
+    }
+
+    /** True while the engine is skipping silent blocks. */
+    bool isSleeping() const { return sleeping; }
+
+    /** True while identical L/R input is being processed once. */
+    bool isDualMono() const { return dualMono; }
+
+    /**
+     * Processes any host block size. Internally everything runs in fixed tiles
+     * of `tileSize` samples, so each tile's working set (including the
+     * oversampled copy) stays cache-resident from the split to the DC blocker.
+     *
+     * Once input and output have both stayed below silenceThreshold for longer
+     * than the tail, the engine sleeps: silent blocks are cleared and nothing
+     * else runs. The state is left in place (it has already decayed below the
+     * threshold) and the first block with signal wakes it with a short fade-in.
+     */
+    void process(juce::AudioBuffer<SampleType>& buffer, const ParameterSnapshot& params)
     {
-        auto totalSamples = buffer.getNumSamples();
+        const int totalSamples = buffer.getNumSamples();
         auto* channelDataL = buffer.getWritePointer(0);
-        auto* channelDataR = numChannels > 1 ? buffer.getWritePointer(1) : nullptr;
+        auto* channelDataR = stereo ? buffer.getWritePointer(1) : nullptr;
+        jassert(buffer.getNumChannels() >= NumChannels);
+
+        // --- SLEEP ---
+        const bool inputSilent = isSilent(buffer, totalSamples);
+
+        if (sleeping)
+        {
+            if (inputSilent)
+            {
+                buffer.clear();
+                return;
+            }
+
+            sleeping = false;
+            report(HealthEvent::Wake);
+            wakeFade.reset(0.0f);
+            wakeFade.setTarget(1.0f);
+        }
         
-        chaosLFO.setBPM(bpm);
+        chaosLFO.setBPM(params.bpm);
+
+        updateTier();
+
+        // --- PARAMETER RAMPS ---
+        // Continuous parameters glide per sample instead of stepping per block.
+        // Targets are set per block; each tile renders its slice of the ramp.
+        ramps.setTargets(params);
+        updatePlan();
+        updateDualMono(channelDataL, channelDataR, totalSamples, params);
+
+        // Update Filter Mode
+        const auto filterType = params.vowelMode ? AetherFilter<SampleType>::FilterType::Formant
+                                                 : AetherFilter<SampleType>::FilterType::Morph;
+        filterL.setType(filterType);
+        filterR.setType(filterType);
+
+        // Tunable Crossover (block rate: retuning the SVFs per sample is not worth it for a 60-300 Hz split)
+        float safeXOver = std::clamp(params.xover, 60.0f, 300.0f);
+        crossoverL.setCutoff(safeXOver);
+        if constexpr (stereo) crossoverR.setCutoff(safeXOver);
+        linearCrossover.setCutoff(safeXOver);
+
+        int badSamples = 0;
+
+        for (int start = 0; start < totalSamples; start += tileSize)
+        {
+            const int n = juce::jmin(tileSize, totalSamples - start);
+
+            // Dual mono or not is decided per tile, so the per-sample loops never test it
+            bool healthy;
+            if constexpr (stereo)
+                healthy = dualMono ? processTile<false>(channelDataL + start, channelDataR + start, n, params, badSamples)
+                                   : processTile<true>(channelDataL + start, channelDataR + start, n, params, badSamples);
+            else
+                healthy = processTile<false>(channelDataL + start, nullptr, n, params, badSamples);
+
+            if (!healthy)
+            {
+                // WATCHDOG TRIGGERED: A NaN was detected in the signal path.
+                // Action: Instant Reset.
+                report(HealthEvent::NanRecovery);
+                reset();
+                buffer.clear(); // Output silence for this block to save speakers.
+                return;
+            }
+        }
+
+        // --- 8. NUCLEAR WATCHDOG (Panic Switch) ---
+        // Secondary Safety: Rail Detection
+        // Even if NaNs aren't present, if the signal is "stuck" at the rail (+/- 2.0)
+        // for > 25% of the time, something is very wrong (DC explosion or feedback loop howl).
+
+        // Threshold: 25% of samples are clipped hard.
+        if (badSamples > (totalSamples * NumChannels) / 4)
+        {
+            // likely broken/exploded. Reboot.
+            report(HealthEvent::RailTrip, badSamples);
+            reset();
+        }
+
+        // Per-module guards heal themselves; count them here, once per block
+        const int recovered = filterL.takeRecoveries() + filterR.takeRecoveries()
+                            + resonatorL.takeRecoveries() + resonatorR.takeRecoveries()
+                            + noiseGen.takeRecoveries();
+        if (recovered > 0)
+            report(HealthEvent::ModuleRecovery, recovered);
+
+        // Count silent samples; the tail follows the parameters, so recheck it every block
+        if (inputSilent && isSilent(buffer, totalSamples))
+        {
+            silentSamples += totalSamples;
+            if ((double)silentSamples > computeTailSeconds(params) * preparedSpec.sampleRate)
+            {
+                sleeping = true;
+                report(HealthEvent::Sleep);
+            }
+        }
+        else
+        {
+            silentSamples = 0;
+        }
+    }
+
+private:
+    void report(HealthEvent event, int value = 1)
+    {
+        if (health != nullptr) health->report(event, value, healthGroup);
+    }
+
+    /**
+     * One tile through the whole chain. Returns false if the NaN watchdog fired.
+     * Rail hits are added to badSamples for the block-level watchdog.
+     * Pair: the right channel runs its own per-channel stages (stereo, not dual mono).
+     */
+    template <bool Pair>
+    bool processTile(SampleType* channelDataL, SampleType* channelDataR, int numSamples,
+                     const ParameterSnapshot& params, int& badSamples)
+    {
+        ramps.render(numSamples);
+        StageClock clock(profiler, profileGroup);
+        static_assert(stereo || !Pair, "Only a stereo engine has a right channel chain");
+
+        const int stages = juce::jmin(params.stages, tier.maxStages);
+        const auto algoPos = params.algoPos;
+        const auto algoNeg = params.algoNeg;
         
         // --- NOISE INJECTION (Dynamic & Distorted) ---
         // We use the FLUX envelope for gating the noise (Dynamic Texture)
@@ -188,222 +709,330 @@ public:
         // Actually, flux is calculated inside the loop based on inputEnergy.
         // But doing it sample-by-sample here creates a delay of 1 sample or requires calc.
         
-        auto nType = static_cast<typename AetherNoise<SampleType>::NoiseType>(noiseType);
+        auto nType = static_cast<typename AetherNoise<SampleType>::NoiseType>(params.noiseType);
         
-        for (int s = 0; s < totalSamples; ++s)
+        if (plan.noise)
         {
-            SampleType& left = channelDataL[s];
-            SampleType& right = channelDataR ? channelDataR[s] : left;
+            for (int s = 0; s < numSamples; ++s)
+            {
+                SampleType& left = channelDataL[s];
+                SampleType& right = stereo ? channelDataR[s] : left;
             
-            // Calc Envelopes for this sample (Pre-calc for noise gate)
-            // We use the same flux logic as in the High Band loop, but this is the full broadband input here.
-            float inputEnergy = (std::abs(left) + std::abs(right)) * 0.5f;
-            float envelope = noiseGateFollower.processSample(inputEnergy); // Use Tight Gate
-            fluxFollower.processSample(inputEnergy); // Keep main flux updated too (for visualizer etc?) 
-            // Actually fluxFollower IS updated in the high band loop later, but only for highs.
-            // If we want fluxFollower to track broadband for other purposes we should update it here, 
-            // but currently it is seemingly unused here except for the noise envelope previously.
-            // Wait, look at line 287: fluxFollower.processSample is called AGAIN in the high band loop.
-            // We should ensure we aren't "double clocking" it if it's the same object?
-            // Yes, "fluxFollower" is a member. If we call processSample here and later, it updates twice per sample (roughly).
-            // Actually the second loop is on the High Band signal. 
-            // Let's just use noiseGateFollower here. The fluxFollower update here was likely for noise only.
-            // So we can remove the fluxFollower call here if it's only used for noise.
+                // Calc Envelopes for this sample (Pre-calc for noise gate)
+                // We use the same flux logic as in the High Band loop, but this is the full broadband input here.
+                float inputEnergy = (std::abs(left) + std::abs(right)) * 0.5f;
+                float envelope = noiseGateFollower.processSample(inputEnergy); // Use Tight Gate
+                fluxFollower.processSample(inputEnergy); // Keep main flux updated too (for visualizer etc?) 
+                // Actually fluxFollower IS updated in the high band loop later, but only for highs.
+                // If we want fluxFollower to track broadband for other purposes we should update it here, 
+                // but currently it is seemingly unused here except for the noise envelope previously.
+                // Wait, look at line 287: fluxFollower.processSample is called AGAIN in the high band loop.
+                // We should ensure we aren't "double clocking" it if it's the same object?
+                // Yes, "fluxFollower" is a member. If we call processSample here and later, it updates twice per sample (roughly).
+                // Actually the second loop is on the High Band signal. 
+                // Let's just use noiseGateFollower here. The fluxFollower update here was likely for noise only.
+                // So we can remove the fluxFollower call here if it's only used for noise.
             
-            // noiseWidth parameter is now DISTORTION for the noise
-            float noiseDistortion = noiseWidth; 
+                // noiseWidth parameter is now DISTORTION for the noise
+                float noiseDistortion = ramps.noiseWidth.get(s); 
             
-            noiseGen.process(left, right, noiseLevel, noiseDistortion, nType, envelope);
+                noiseGen.process(left, right, ramps.noiseLevel.get(s), noiseDistortion, nType, envelope);
+            }
         }
-
-        // Update Filter Mode
-        if (vowelMode)
-            filter.setType(AetherFilter<SampleType>::FilterType::Formant);
         else
-            filter.setType(AetherFilter<SampleType>::FilterType::Morph);
+        {
+            // Noise off: the flux follower is still clocked by the broadband input
+            for (int s = 0; s < numSamples; ++s)
+            {
+                const SampleType left = channelDataL[s];
+                const SampleType right = stereo ? channelDataR[s] : left;
+                fluxFollower.processSample((std::abs(left) + std::abs(right)) * 0.5f);
+            }
+        }
 
-        // Tunable Crossover
-        float safeXOver = std::clamp(xoverHz, 60.0f, 300.0f);
-        crossoverL.setCutoff(safeXOver);
-        if (channelDataR) crossoverR.setCutoff(safeXOver);
+        clock.lap(ProfileStage::Noise);
 
         // --- SPLIT BANDS ---
         // We need separate buffers for Low and High.
         // Since we are oversampling Highs, we need to extract them first.
+        // Both are tile-sized and allocated in prepare().
         
-        juce::AudioBuffer<SampleType> highBuffer;
-        highBuffer.makeCopyOf(buffer); // Start with input
-        
-        juce::AudioBuffer<SampleType> lowBuffer;
-        lowBuffer.setSize(numChannels, totalSamples);
-        
-        auto* hL = highBuffer.getWritePointer(0);
-        auto* hR = numChannels > 1 ? highBuffer.getWritePointer(1) : nullptr;
-        auto* lL = lowBuffer.getWritePointer(0);
-        auto* lR = numChannels > 1 ? lowBuffer.getWritePointer(1) : nullptr;
+        auto* hL = highTile.getWritePointer(0);
+        auto* hR = stereo ? highTile.getWritePointer(1) : nullptr;
+        auto* lL = lowTile.getWritePointer(0);
+        // Dual mono: only the left crossover runs and the right high band is a copy,
+        // which keeps the oversampler's right-channel state identical to the left.
+        auto* lR = Pair ? lowTile.getWritePointer(1) : nullptr;
+
+        juce::FloatVectorOperations::copy(hL, channelDataL, numSamples); // Start with input
+        if constexpr (stereo) juce::FloatVectorOperations::copy(hR, channelDataR, numSamples);
         
         // 1. Perform Crossover Split (at 1x)
-        for (int s = 0; s < totalSamples; ++s)
+        if (useLinearCrossover)
+        {
+            // Block FFT convolution; high = delayed input - low, in place on the high tile
+            const float* in[] = { hL, Pair ? hR : nullptr };
+            float* lows[] = { lL, lR };
+            float* highs[] = { hL, Pair ? hR : nullptr };
+            linearCrossover.process(in, lows, highs, Pair ? 2 : 1, numSamples);
+
+            if constexpr (stereo && !Pair) juce::FloatVectorOperations::copy(hR, hL, numSamples);
+        }
+        else
         {
-            SampleType inL = hL[s];
-            SampleType inR = hR ? hR[s] : 0;
+            for (int s = 0; s < numSamples; ++s)
+            {
+                SampleType inL = hL[s];
+                SampleType lL_out, hL_out;
             
-            SampleType lL_out, hL_out, lR_out, hR_out;
+                crossoverL.process(inL, lL_out, hL_out);
             
-            crossoverL.process(inL, lL_out, hL_out);
-            if (hR) {
-                crossoverR.process(inR, lR_out, hR_out);
-            } else {
-                lR_out = lL_out; hR_out = hL_out;
+                // Store split signals
+                lL[s] = lL_out;
+                hL[s] = hL_out;
+
+                if constexpr (Pair)
+                {
+                    SampleType lR_out, hR_out;
+                    crossoverR.process(hR[s], lR_out, hR_out);
+                    lR[s] = lR_out;
+                    hR[s] = hR_out;
+                }
+                else if constexpr (stereo)
+                {
+                    hR[s] = hL_out;
+                }
             }
-            
-            // Store split signals
-            lL[s] = lL_out;
-            if (lR) lR[s] = lR_out;
-            
-            hL[s] = hL_out;
-            if (hR) hR[s] = hR_out;
         }
+
+        clock.lap(ProfileStage::Split);
         
         // --- 2. PROCESS LOWS (1x Rate) ---
         // Clean Sub saturation
-        for (int s = 0; s < totalSamples; ++s)
+        for (int s = 0; s < numSamples; ++s)
         {
             SampleType sl = lL[s];
-            SampleType sr = lR ? lR[s] : sl;
-            subProcessor.process(sl, sr, subLevel, drive); // Sub now reacts slightly to main drive for "Warmth"
+            SampleType sr = Pair ? lR[s] : sl;
+            subProcessor.process(sl, sr, ramps.sub.get(s), ramps.drive.get(s)); // Sub now reacts slightly to main drive for "Warmth"
             lL[s] = sl;
-            if (lR) lR[s] = sr;
+            if constexpr (Pair) lR[s] = sr;
         }
 
+        // Linear-phase oversampling delays the highs: keep the lows in line with them
+        lowDelay.process(lL, 0, numSamples);
+        if constexpr (Pair) lowDelay.process(lR, 1, numSamples);
+        clock.lap(ProfileStage::Lows);
+
         // --- 3. UPSAMPLE HIGHS ---
-        juce::dsp::AudioBlock<SampleType> highBlock(highBuffer);
-        juce::dsp::AudioBlock<SampleType> upsampledBlock = oversampler.processSamplesUp(highBlock);
+        // A stereo engine runs both lanes, dual mono included (its right lane stays
+        // in step with the left); a mono engine's oversampler has the one lane
+        oversampler.processUp(hL, hR, numSamples);
+        clock.lap(ProfileStage::Upsample);
         
-        auto* upL = upsampledBlock.getChannelPointer(0);
-        auto* upR = numChannels > 1 ? upsampledBlock.getChannelPointer(1) : nullptr;
-        int upSamples = (int)upsampledBlock.getNumSamples();
+        auto* upL = oversampler.getUpChannel(0);
+        auto* upR = stereo ? oversampler.getUpChannel(1) : nullptr;
+        const int upSamples = numSamples * oversamplingFactor;
         
-        // --- 4. PROCESS HIGHS (4x Rate) ---
+        // --- 4. PROCESS HIGHS (Oversampled Rate) ---
+        // One pass per stage over the oversampled tile, so each stage's state stays
+        // hot and the plan decides once per block which passes run at all.
+        // Ramps run at 1x, so every pass holds each value across the oversampled
+        // sub-samples: r = s / oversamplingFactor.
         // We need to advance LFO/Flux slower relative to sample rate?
         // Actually, parameters usually modulation at Control Rate, but here we calculate per sample.
         // It's fine to run LFO at 4x speed (higher temporal resolution) or we should compensate increments.
         // For chaos, 4x speed is fine, just smoother chaos.
-        
+
+        // 4a. Modulation
+        float* flux = fluxTile.data();
+        float* chaos = chaosTile.data();
+
+        // Calc Mod (We use linear interpolation of previous 1x energy? 
+        // Or just calculate pure new energy at 4x? 4x is better.)
+        simd.inputEnergy(upL, upR, flux, upSamples); // Energy first (vectorised), then the follower in place
+
         for (int s = 0; s < upSamples; ++s)
         {
-            SampleType left = upL[s];
-            SampleType right = upR ? upR[s] : 0;
-            
-            // Calc Mod (We use linear interpolation of previous 1x energy? 
-            // Or just calculate pure new energy at 4x? 4x is better.)
-            float inputEnergy = (std::abs(left) + std::abs(right)) * 0.5f;
-            float flux = fluxFollower.processSample(inputEnergy);
-            float chaos = chaosLFO.getNextSample(); // This will run LFO 4x faster! 
+            flux[s] = fluxFollower.processSample(flux[s]);
+            chaos[s] = chaosLFO.getNextSample(); // This will run LFO 4x faster! 
             // Compensation: LFO phase increment is based on SampleRate. 
             // `chaosLFO.prepare` was called with 1x sampleRate?
             // If prepared with 1x, and called 4x often, LFO is 4x faster.
             // We should ideally update `chaosLFO` setup, but "Drift" LFO being faster is likely fine for "Plasma".
-            
-            float dynDrive = drive + (flux * drive * 0.5f); 
-            float dynCutoff = cutoff + (chaos * 500.0f * scramble); 
-            dynCutoff = std::clamp(dynCutoff, 20.0f, 20000.0f);
-            float dynMorph = morph + (flux * 0.2f);
-            
-            // Decimate logic (Needs update for 4x?)
-            // Decimate reduces sample rate. 
-            // If we are at 4x, decimate needs to hold 4x longer to sound same.
-            // Fold logic (Renamed from Decimate)
-            if (fold > 0.0f)
+        }
+
+        clock.lap(ProfileStage::Modulation);
+
+        // The right channel through the per-channel stages (Pair only)
+        SampleType* chainR = Pair ? upR : nullptr;
+
+        // 4b. Fold (Renamed from Decimate)
+        // Decimate reduces sample rate. 
+        // If we are oversampled, decimate needs to hold proportionally longer to sound same.
+        // fold == 0 gives a hold of one sample, i.e. a pass-through, so no per-sample test.
+        if (plan.fold)
+        {
+            for (int s = 0; s < upSamples; ++s)
             {
-                float rateReduction = fold * 40.0f * 4.0f; // Scale up for oversampling
+                float rateReduction = ramps.fold.get(s / oversamplingFactor) * 40.0f * (float)oversamplingFactor; // Scale up for oversampling
                 if (rateReduction < 1.0f) rateReduction = 1.0f;
-                static float holdL=0, holdR=0, counter=0;
-                counter++;
-                if (counter >= rateReduction) { counter = 0; holdL = left; holdR = right; }
-                else { left = holdL; right = holdR; }
+                foldCounter++;
+                if (foldCounter >= rateReduction)
+                {
+                    foldCounter = 0;
+                    foldHoldL = upL[s];
+                    if constexpr (Pair) foldHoldR = chainR[s];
+                }
+                else
+                {
+                    upL[s] = foldHoldL;
+                    if constexpr (Pair) chainR[s] = foldHoldR;
+                }
             }
-            
-            // Distortion with Chaotic Asymmetry (Tilt)
-            // Injecting a tiny DC offset based on flux and chaos creates asymmetric grit
-            float tilt = (flux * 0.05f) + (chaos * 0.02f * scramble);
-            left = distortion.processSample(left + tilt, dynDrive, fold, algoPos, algoNeg, stages) - tilt;
-            right = distortion.processSample(right + tilt, dynDrive, fold, algoPos, algoNeg, stages) - tilt;
-            
-            // Filter
-            filter.setParams(dynCutoff, resonance, dynMorph);
-            left = filter.processSample(left);
-            right = filter.processSample(right);
+        }
+
+        clock.lap(ProfileStage::Fold);
+
+        // 4c. Distortion + Filter (always on)
+        // Distortion with Chaotic Asymmetry (Tilt): a tiny DC offset based on flux
+        // and chaos creates asymmetric grit. It is stateless, so it runs as one
+        // kernel pass over the tile; the filter after it is recursive and stays per sample.
+        float* dynDrive = driveTile.data();
+        float* tilt = tiltTile.data();
+
+        for (int s = 0; s < upSamples; ++s)
+        {
+            const int r = s / oversamplingFactor;
+            const float drive = ramps.drive.get(r);
+            dynDrive[s] = drive + (flux[s] * drive * 0.5f);
+            tilt[s] = (flux[s] * 0.05f) + (chaos[s] * 0.02f * ramps.scramble.get(r));
+        }
+
+        simd.distortion(upL, dynDrive, tilt, ramps.fold.getRamp(), ramps.fold.getCurrent(), oversamplingFactor,
+                        upSamples, (int)algoPos, (int)algoNeg, stages);
+        if constexpr (Pair)
+            simd.distortion(chainR, dynDrive, tilt, ramps.fold.getRamp(), ramps.fold.getCurrent(), oversamplingFactor,
+                            upSamples, (int)algoPos, (int)algoNeg, stages);
+
+        for (int s = 0; s < upSamples; ++s)
+        {
+            const int r = s / oversamplingFactor;
+
+            // Filter (one coefficient update per control period, shared by both channels)
+            if (--controlCountdown <= 0)
+            {
+                controlCountdown = tier.controlInterval;
+                float dynCutoff = ramps.cutoff.get(r) + (chaos[s] * 500.0f * ramps.scramble.get(r));
+                dynCutoff = std::clamp(dynCutoff, 20.0f, 20000.0f);
+                float dynMorph = ramps.morph.get(r) + (flux[s] * 0.2f);
+                filterL.setParams(dynCutoff, ramps.res.get(r), dynMorph);
+            }
+            SampleType left = filterL.processSample(upL[s]);
             
             // Safety
             if (std::abs(left) > 10.0f) left = std::tanh(left);
-            if (std::abs(right) > 10.0f) right = std::tanh(right);
-            
-            // Resonator
-            float dynFb = fbAmount + (flux * 0.1f * scramble);
-            left = resonator.processSample(left, dynFb, fbTimeMs, scramble);
-            right = resonator.processSample(right, dynFb, fbTimeMs, scramble);
-            
-            // Dimension (Stereo Width)
-            dimension.process(left, right, width);
-            
-            // Squeeze
-            if (squeeze > 0.0f) {
-                // ... Squeeze implementation ...
-                // Simplified for brevity in replacement (Inline logic again)
-                float envL = std::abs(left) + 0.01f;
-                float gainL = (1.0f / std::sqrt(envL));
-                left *= (1.0f + (gainL - 1.0f) * squeeze);
-                
-                float envR = std::abs(right) + 0.01f;
-                float gainR = (1.0f / std::sqrt(envR));
-                right *= (1.0f + (gainR - 1.0f) * squeeze);
-            }
-            
             upL[s] = left;
-            if (upR) upR[s] = right;
+
+            if constexpr (Pair)
+            {
+                filterR.copyParamsFrom(filterL);
+                SampleType right = filterR.processSample(chainR[s]);
+                if (std::abs(right) > 10.0f) right = std::tanh(right);
+                chainR[s] = right;
+            }
+        }
+
+        clock.lap(ProfileStage::DistortionFilter);
+
+        // 4d. Resonator
+        if (plan.resonator)
+        {
+            for (int s = 0; s < upSamples; ++s)
+            {
+                const int r = s / oversamplingFactor;
+                const float scramble = ramps.scramble.get(r);
+                float dynFb = ramps.fbAmount.get(r) + (flux[s] * 0.1f * scramble);
+                const float fbTimeMs = ramps.fbTime.get(r);
+                upL[s] = resonatorL.processSample(upL[s], dynFb, fbTimeMs, scramble);
+                if constexpr (Pair) chainR[s] = resonatorR.processSample(chainR[s], dynFb, fbTimeMs, scramble);
+            }
+        }
+
+        clock.lap(ProfileStage::Resonator);
+
+        // Dual mono ends here: width (and squeeze after it) work on a real stereo pair
+        if constexpr (stereo && !Pair)
+            juce::FloatVectorOperations::copy(upR, upL, upSamples);
+
+        // 4e. Dimension (Stereo Width)
+        if (plan.dimension)
+        {
+            for (int s = 0; s < upSamples; ++s)
+            {
+                SampleType left = upL[s];
+                SampleType right = stereo ? upR[s] : 0;
+
+                dimension.process(left, right, ramps.width.get(s / oversamplingFactor));
+
+                upL[s] = left;
+                if constexpr (stereo) upR[s] = right;
+            }
         }
+
+        clock.lap(ProfileStage::Dimension);
+
+        // 4f. Squeeze (squeeze == 0 leaves the sample untouched, so no per-sample test)
+        if (plan.squeeze)
+        {
+            const float* amount = ramps.squeeze.getRamp();
+            const float constant = ramps.squeeze.getCurrent();
+
+            simd.squeeze(upL, upSamples, amount, constant, oversamplingFactor);
+            if constexpr (stereo) simd.squeeze(upR, upSamples, amount, constant, oversamplingFactor);
+        }
+
+        clock.lap(ProfileStage::Squeeze);
         
         // --- 5. DOWNSAMPLE HIGHS ---
-        oversampler.processSamplesDown(highBlock); // Writes back to highBlock (highBuffer)
+        oversampler.processDown(hL, hR, numSamples); // In place: back into highTile
+        clock.lap(ProfileStage::Downsample);
         
         // --- 6. SUM & OUTPUT ---
-        // Note: processSamplesDown writes result to the input block passed to processSamplesUp?
-        // No, processSamplesDown writes to the *original* block (highBlock).
         
-        // We have `highBuffer` now containing processed, downsampled highs.
-        // And `lowBuffer` containing processed lows.
+        // We have `highTile` now containing processed, downsampled highs.
+        // And `lowTile` containing processed lows.
         
         auto* outL = channelDataL;
         auto* outR = channelDataR;
-        auto* processedH_L = highBuffer.getReadPointer(0);
-        auto* processedH_R = numChannels > 1 ? highBuffer.getReadPointer(1) : nullptr;
-        
-        for (int s = 0; s < totalSamples; ++s)
+        // Governor tier change in progress: duck the high band around the switch
+        if (highBandGain.render(numSamples))
         {
-            SampleType lLow = lL[s];
-            SampleType lHigh = processedH_L[s];
-            outL[s] = std::tanh(lLow + lHigh);
-            
-            if (outR) {
-                SampleType rLow = lR ? lR[s] : lLow;
-                SampleType rHigh = processedH_R ? processedH_R[s] : 0;
-                outR[s] = std::tanh(rLow + rHigh);
-            }
+            for (int ch = 0; ch < highTile.getNumChannels(); ++ch)
+                juce::FloatVectorOperations::multiply(highTile.getWritePointer(ch), highBandGain.getRamp(), numSamples);
+        }
+        else if (highBandGain.getCurrent() == 0.0f)
+        {
+            highTile.clear(0, numSamples);
         }
 
+        auto* processedH_L = highTile.getReadPointer(0);
+        auto* processedH_R = stereo ? highTile.getReadPointer(1) : nullptr;
+        
+        simd.sumSaturate(outL, lL, processedH_L, numSamples);
+        if constexpr (stereo) simd.sumSaturate(outR, Pair ? lR : lL, processedH_R, numSamples);
+
         // --- 7. FINAL SAFETY & DC BLOCK ---
         // Block DC to prevent silent headroom eating
         const float R = 0.9995f; 
 
         bool engineBroken = false;
 
-        for (int s = 0; s < totalSamples; ++s)
+        for (int s = 0; s < numSamples; ++s)
         {
             SampleType inL = outL[s];
             
             // IMMEDIATE WATCHDOG: Check for NaN before anything else
-            if (!std::isfinite(inL) || (outR && !std::isfinite(outR[s])))
+            if (!std::isfinite(inL) || (stereo && !std::isfinite(outR[s])))
             {
                 engineBroken = true;
                 break;
@@ -418,7 +1047,7 @@ public:
             
             outL[s] = outL_s;
 
-            if (outR)
+            if constexpr (stereo)
             {
                 SampleType inR = outR[s];
                 SampleType outR_s = inR - dcR_x1 + R * dcR_y1;
@@ -431,40 +1060,187 @@ public:
             }
         }
         
-        // If engine broke during this block, NUCLEAR RESET immediately.
+        // If engine broke during this tile, the caller does the NUCLEAR RESET immediately.
         if (engineBroken)
+            return false;
+
+        // Just woke up: fade in over any residue left in the stalled state
+        if (wakeFade.render(numSamples))
         {
-            // WATCHDOG TRIGGERED: A NaN was detected in the signal path.
-            // Action: Instant Reset.
-            reset();
-            buffer.clear(); // Output silence for this block to save speakers.
+            juce::FloatVectorOperations::multiply(outL, wakeFade.getRamp(), numSamples);
+            if constexpr (stereo) juce::FloatVectorOperations::multiply(outR, wakeFade.getRamp(), numSamples);
+        }
+
+        // Rail hits feed the block-level watchdog in process()
+        badSamples += simd.countAbove(outL, numSamples, 1.95f);
+        if constexpr (stereo) badSamples += simd.countAbove(outR, numSamples, 1.95f);
+
+        clock.lap(ProfileStage::Output);
+        return true;
+    }
+
+    void prepareRamps(const juce::dsp::ProcessSpec& spec)
+    {
+        const auto lin = ParameterRamp::Shape::Linear;
+        ramps.prepare(spec.sampleRate, tileSize);
+
+        wakeFade.prepare(spec.sampleRate, tileSize, 0.005, lin);
+        wakeFade.reset(1.0f);
+
+        highBandGain.prepare(spec.sampleRate, tileSize, 0.01, lin);
+        highBandGain.reset(1.0f);
+    }
+
+    void updatePlan()
+    {
+        const auto next = StagePlan::from(ramps);
+
+        // A stage that switches off has already ramped to its pass-through value.
+        // Clear what it holds so it comes back from silence, not from stale state.
+        if (plan.noise && !next.noise) noiseGateFollower.reset();
+        if (plan.fold && !next.fold) { foldHoldL = 0; foldHoldR = 0; foldCounter = 0; }
+        if (plan.resonator && !next.resonator) { resonatorL.reset(); resonatorR.reset(); }
+        if (plan.dimension && !next.dimension) dimension.reset();
+
+        plan = next;
+    }
+
+    /**
+     * Dual mono: while L and R arrive bit-identical and no (stereo) noise is added,
+     * only the left chain runs up to the dimension stage and the right channel
+     * follows as a copy. It switches in once the inputs have matched for longer
+     * than the tail, so the right-side state has converged onto the left; when
+     * the inputs diverge, the right side is resynced from the left first.
+     */
+    void updateDualMono(const SampleType* l, const SampleType* r, int numSamples, const ParameterSnapshot& params)
+    {
+        const bool identical = r != nullptr && !plan.noise
+                            && std::memcmp(l, r, sizeof(SampleType) * (size_t)numSamples) == 0;
+
+        if (identical)
+        {
+            identicalSamples += numSamples;
+            if (!dualMono && (double)identicalSamples > computeTailSeconds(params) * preparedSpec.sampleRate)
+                dualMono = true;
             return;
         }
 
-        // --- 8. NUCLEAR WATCHDOG (Panic Switch) ---
-        // Secondary Safety: Rail Detection
-        // Even if NaNs aren't present, if the signal is "stuck" at the rail (+/- 2.0)
-        // for > 25% of the time, something is very wrong (DC explosion or feedback loop howl).
-        
-        int badSamples = 0;
-        for (int s = 0; s < totalSamples; ++s)
+        identicalSamples = 0;
+
+        if (dualMono)
         {
-            if (std::abs(outL[s]) >= 1.95f) badSamples++;
-            if (outR && std::abs(outR[s]) >= 1.95f) badSamples++;
+            dualMono = false;
+
+            // Same-sized containers throughout: these copy, never allocate
+            crossoverR = crossoverL;
+            linearCrossover.copyChannel(0, 1);
+            filterR = filterL;
+            if (plan.resonator) resonatorR = resonatorL; // Otherwise both are already cleared
+            foldHoldR = foldHoldL;
+            lowDelay.copyChannel(0, 1);
         }
+    }
 
-        // Threshold: 25% of samples are clipped hard.
-        if (badSamples > (totalSamples * numChannels) / 4)
+    bool isSilent(const juce::AudioBuffer<SampleType>& buffer, int numSamples) const
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            if (buffer.getMagnitude(ch, 0, numSamples) >= silenceThreshold)
+                return false;
+
+        return true;
+    }
+
+    /**
+     * Steps towards pendingTier: start the duck, or, once the high band is
+     * silent, apply the tier and start the fade back in.
+     */
+    void updateTier()
+    {
+        if (pendingTier == tierIndex || highBandGain.getCurrent() != highBandGain.getTarget())
+            return; // Nothing to do, or a duck/fade is still running
+
+        if (highBandGain.getCurrent() > 0.0f)
         {
-            // likely broken/exploded. Reboot.
-            reset();
+            highBandGain.setTarget(0.0f);
+            return;
+        }
+
+        const bool ecoChanged = QualityTier::get(pendingTier).forceEco != tier.forceEco;
+        tierIndex = pendingTier;
+        tier = QualityTier::get(tierIndex);
+        controlCountdown = 0;
+
+        if (ecoChanged)
+        {
+            // New oversampling factor: restart the high band from silence (it is muted anyway)
+            applyQuality(); // Also restarts the oversampler
+            filterL.reset(); filterR.reset();
+            resonatorL.reset(); resonatorR.reset();
+            dimension.reset();
+            foldHoldL = 0; foldHoldR = 0; foldCounter = 0;
         }
+
+        highBandGain.setTarget(1.0f);
     }
 
-private:
-    AetherDistortion<SampleType> distortion;
-    AetherFilter<SampleType> filter;
-    AetherResonator<SampleType> resonator;
+    void applyQuality()
+    {
+        const auto effectiveQuality = tier.forceEco ? EngineQuality::Eco : quality;
+        const int factor = effectiveQuality == EngineQuality::High ? 4 : 2;
+
+        // Linear phase keeps the 4x latency at 2x too, so a governor step never changes it
+        if (linearPhase)
+            oversampler.setConfiguration(factor, OversamplingFilter::LinearPhaseFIR, oversampler.getFIRLatency(4));
+        else
+            oversampler.setConfiguration(factor, OversamplingFilter::PolyphaseIIR);
+
+        oversamplingFactor = factor;
+
+        // Only whole-sample latency is compensated; the IIR path stays minimum phase
+        lowDelay.setDelay(linearPhase ? (int)oversampler.getLatencySamples() : 0);
+        latencySamples = lowDelay.getDelay() + (useLinearCrossover ? linearCrossover.getLatencySamples() : 0);
+
+        juce::dsp::ProcessSpec oversampledSpec = preparedSpec;
+        oversampledSpec.sampleRate = preparedSpec.sampleRate * oversamplingFactor;
+        oversampledSpec.maximumBlockSize = (juce::uint32)(tileSize * oversamplingFactor);
+
+        filterL.prepare(oversampledSpec);
+        filterR.prepare(oversampledSpec);
+        resonatorL.setSampleRate(oversampledSpec.sampleRate);
+        resonatorR.setSampleRate(oversampledSpec.sampleRate);
+        dimension.setSampleRate(oversampledSpec.sampleRate); // Shrinks within the 4x allocation
+
+        // Flux and chaos are clocked once per oversampled sample but were voiced
+        // at 4x with 1x coefficients. Keep that feel at every factor.
+        const double modRate = preparedSpec.sampleRate * oversamplingFactor / 4.0;
+        chaosLFO.prepare(modRate);
+        fluxFollower.prepare(modRate);
+        fluxFollower.setParams(10.0f, 300.0f);
+    }
+
+    // ==========================================================================
+    // HOT: everything the per-sample loops read or write, packed together from
+    // a cache-line boundary. Only small objects live here; any bulk storage they
+    // own (delay lines, APF buffers) is a separate heap block touched at one or
+    // two positions per sample. Keep new per-sample state in this section.
+    // ==========================================================================
+
+    // Safety
+    alignas(64) SampleType dcL_x1=0, dcL_y1=0;
+    SampleType dcR_x1=0, dcR_y1=0;
+
+    // Fold sample-and-hold
+    float foldHoldL = 0, foldHoldR = 0, foldCounter = 0;
+    int controlCountdown = 0;
+
+    int oversamplingFactor = 4;
+    StagePlan plan;
+    QualityTier tier;
+    bool dualMono = false;
+    bool sleeping = false;
+
+    // Per-channel: the shared instances used to interleave L and R through one state
+    AetherFilter<SampleType> filterL, filterR;
     
     // Neuro Components
     AetherCrossover<SampleType> crossoverL, crossoverR;
@@ -474,20 +1250,60 @@ private:
     AetherLFO chaosLFO;
     AetherEnvelopeFollower fluxFollower;
     AetherEnvelopeFollower noiseGateFollower;
+
+    AetherResonator<SampleType> resonatorL, resonatorR;
     
     // Width
     AetherDimension dimension;
     AetherNoise<SampleType> noiseGen;
-    
+
+    // ==========================================================================
+    // COLD: block-rate bookkeeping, prepare-time objects and scratch buffers.
+    // ==========================================================================
+
     // Hi-Fi
-    // Factor 2 = 4x Oversampling
-    juce::dsp::Oversampling<SampleType> oversampler { 2, 2, juce::dsp::Oversampling<SampleType>::filterHalfBandPolyphaseIIR, true };
-    
-    int numChannels = 2;
-    
-    // Safety
-    SampleType dcL_x1=0, dcL_y1=0;
-    SampleType dcR_x1=0, dcR_y1=0;
+    alignas(64) EngineQuality quality = EngineQuality::High; // User setting; the governor may force Eco
+    bool linearPhase = false;
+    bool useLinearCrossover = false;
+    int latencySamples = 0;
+
+    // Governor
+    int tierIndex = 0;
+    int pendingTier = 0;
+    ParameterRamp highBandGain;
+    juce::dsp::ProcessSpec preparedSpec { 44100.0, 512, 2 };
+
+    // Block kernels for the best ISA on this CPU
+    const kernels::KernelTable& simd = kernels::get();
+
+    EngineRamps ramps;
+
+    // Sleep mode
+    ParameterRamp wakeFade;
+    juce::int64 silentSamples = 0;
+
+    // Dual mono
+    juce::int64 identicalSamples = 0;
+
+    // Event counters and log (see AetherHealth.h), owned by the processor
+    HealthMonitor* health = nullptr;
+    int healthGroup = 0;
+
+    // Developer timings (see AetherProfiler.h), owned by the processor
+    StageProfiler* profiler = nullptr;
+    int profileGroup = 0;
+
+    // Tile scratch: split bands and per-sample modulation, allocated in prepare()
+    juce::AudioBuffer<SampleType> highTile, lowTile;
+    std::vector<float> fluxTile, chaosTile, driveTile, tiltTile;
+
+    // 4x (High) or 2x (Eco). Filter state and coefficients are inline in the
+    // object; only its tile buffers live on the heap.
+    AetherOversampler<SampleType> oversampler;
+    DelayCompensation<SampleType> lowDelay;
+
+    // Linear-phase alternative to crossoverL/R (FFT buffers and kernels on the heap)
+    AetherLinearPhaseCrossover linearCrossover;
 };
 
 } // namespace aether
@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    AetherDelayCompensation.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Whole-sample delay that lines a path up behind a latency elsewhere
+    (the low band behind the linear-phase oversampler, the dry signal
+    behind the engine).
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherCommon.h"
+#include <vector>
+
+namespace aether
+{
+
+template <typename SampleType>
+class DelayCompensation
+{
+public:
+    /** Message thread. Allocates for delays up to maxDelaySamples. */
+    void prepare(int numChannels, int maxDelaySamples)
+    {
+        capacity = juce::jmax(0, maxDelaySamples);
+        lines.assign((size_t)juce::jmax(1, numChannels), std::vector<SampleType>((size_t)capacity + 1, 0));
+        positions.assign(lines.size(), 0);
+        delay = 0;
+    }
+
+    /** Audio thread. Changes the delay (clamped to the prepared maximum) and clears the lines. */
+    void setDelay(int newDelay)
+    {
+        newDelay = juce::jlimit(0, capacity, newDelay);
+        if (newDelay == delay) return;
+
+        delay = newDelay;
+        reset();
+    }
+
+    int getDelay() const { return delay; }
+
+    void reset()
+    {
+        for (auto& line : lines)
+            std::fill(line.begin(), line.end(), (SampleType)0);
+
+        std::fill(positions.begin(), positions.end(), 0);
+    }
+
+    /** Delays one channel in place. */
+    void process(SampleType* data, int channel, int numSamples)
+    {
+        if (delay == 0) return;
+
+        jassert(channel < (int)lines.size());
+        SampleType* line = lines[(size_t)channel].data();
+        int position = positions[(size_t)channel];
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const SampleType delayed = line[position];
+            line[position] = data[i];
+            data[i] = delayed;
+            position = position + 1 == delay ? 0 : position + 1;
+        }
+
+        positions[(size_t)channel] = position;
+    }
+
+    /** Makes channel `to` continue exactly like channel `from` (no allocation). */
+    void copyChannel(int from, int to)
+    {
+        if (juce::jmax(from, to) >= (int)lines.size()) return;
+
+        lines[(size_t)to] = lines[(size_t)from];
+        positions[(size_t)to] = positions[(size_t)from];
+    }
+
+private:
+    std::vector<std::vector<SampleType>> lines;
+    std::vector<int> positions;
+    int capacity = 0;
+    int delay = 0;
+};
+
+} // namespace aether
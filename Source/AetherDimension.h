@@ -13,6 +13,7 @@ namespace aether
 class AllPassFilter
 {
 public:
+    // Only allocates when growing past the largest delay seen so far
     void setDelay(int samples)
     {
         buffer.assign(samples, 0.0f);
@@ -94,7 +95,16 @@ class AetherDimension
 public:
     void prepare(const juce::dsp::ProcessSpec& spec)
     {
-        sampleRate = (float)spec.sampleRate;
+        setSampleRate(spec.sampleRate);
+    }
+
+    /**
+     * Retunes the APF delays. Safe on the audio thread when going down from
+     * the rate passed to prepare() (the delay lines only shrink).
+     */
+    void setSampleRate(double newRate)
+    {
+        sampleRate = (float)newRate;
         
         // Tuning: Prime delays for smooth dense dispersion without metallic resonance
         // Scaled by sample rate to keep consistent time
@@ -15,6 +15,129 @@ class AetherFilter
 {
 public:
     enum class FilterType { LowPass, BandPass, HighPass, Notch, Morph, Formant };
+
+    /** SVF coefficients plus the settings the Morph and Formant modes read per sample. */
+    struct Coefficients
+    {
+        float a1 = 0, a2 = 0, a3 = 0;
+        float k_val = 1.0f;
+        float cutoff = 1000.0f;
+        float resonance = 0.5f;
+        float morph = 0.0f;
+
+        void set(float newCutoff, float res, float newMorph, float sampleRate)
+        {
+            newCutoff = std::clamp(newCutoff, 20.0f, sampleRate * 0.45f);
+            cutoff = newCutoff;
+            resonance = res;
+            morph = std::clamp(newMorph, 0.0f, 0.999f); 
+            
+            float g = std::tan(PI * newCutoff / sampleRate);
+            float r = 2.0f - (1.95f * res); 
+            
+            a1 = 1.0f / (1.0f + g * (g + r));
+            a2 = g * a1;
+            a3 = g * a2;
+            k_val = r;
+        }
+    };
+
+    /** One formant band-pass peak's SVF coefficients. */
+    struct Peak { float a1, a2, a3; };
+
+    /** The three vowel peaks for the current morph, shifted by the cutoff. Same for every channel. */
+    static void formantPeaks(const Coefficients& c, float sampleRate, Peak (&peaks)[3])
+    {
+        struct Vowel { float f1, f2, f3; };
+        static const Vowel vowelTable[5] = {
+            { 730.0f, 1090.0f, 2440.0f }, // A
+            { 530.0f, 1840.0f, 2480.0f }, // E
+            { 270.0f, 2290.0f, 3010.0f }, // I
+            { 570.0f, 840.0f,  2410.0f }, // O
+            { 300.0f, 870.0f,  2240.0f }  // U
+        };
+        
+        float m = c.morph * 3.99f;
+        int i = (int)m;
+        float frac = m - i;
+        int next = (i + 1) % 5;
+        
+        float f1 = vowelTable[i].f1 * (1.0f - frac) + vowelTable[next].f1 * frac;
+        float f2 = vowelTable[i].f2 * (1.0f - frac) + vowelTable[next].f2 * frac;
+        float f3 = vowelTable[i].f3 * (1.0f - frac) + vowelTable[next].f3 * frac;
+        
+        float shift = std::pow(c.cutoff / 800.0f, 0.5f); 
+        f1 *= shift; f2 *= shift; f3 *= shift;
+        
+        float q = 1.0f + (c.resonance * 15.0f); 
+
+        auto design = [&](float freq) -> Peak
+        {
+            freq = std::clamp(freq, 40.0f, sampleRate * 0.45f);
+            float gp = std::tan(PI * freq / sampleRate);
+            float rp = 1.0f / q;
+            float a1p = 1.0f / (1.0f + gp * (gp + rp));
+            float a2p = gp * a1p;
+            float a3p = gp * a2p;
+            return { a1p, a2p, a3p };
+        };
+
+        peaks[0] = design(f1);
+        peaks[1] = design(f2);
+        peaks[2] = design(f3);
+    }
+
+    /** One formant peak; returns its band-pass output. */
+    static SampleType processPeak(const Peak& p, SampleType x, SampleType& sA, SampleType& sB)
+    {
+        SampleType v3p = x - sB;
+        SampleType v1p = p.a1 * sA + p.a2 * v3p;
+        SampleType v2p = sB + p.a3 * sA + p.a2 * v1p;
+        
+        sA = 2.0f * v1p - sA;
+        sB = 2.0f * v2p - sB;
+        
+        return v1p; // Bandpass output
+    }
+
+    /** Sum formant peaks; gain compensation so Vowel mode isn't much quieter than Morph */
+    static SampleType formantOutput(SampleType p1, SampleType p2, SampleType p3)
+    {
+        SampleType output = (p1 * 1.0f + p2 * 0.8f + p3 * 0.6f) * 0.8f;
+        const float formantGainComp = 3.5f; // Formant is very selective, restore level
+        return std::tanh(output * formantGainComp);
+    }
+
+    /** Every mode but Formant: the SVF outputs v1 (band) and v2 (low) mixed for `type`. */
+    static SampleType svfOutput(FilterType type, const Coefficients& c, SampleType x, SampleType v1, SampleType v2)
+    {
+        switch (type)
+        {
+            case FilterType::LowPass:
+                return v2;
+            case FilterType::BandPass:
+                return v1;
+            case FilterType::HighPass:
+                return x - c.k_val * v1 - v2;
+            case FilterType::Notch:
+                return x - c.k_val * v1;
+            case FilterType::Morph:
+                // Morphing between LP -> BP -> HP
+                if (c.morph < 0.5f)
+                {
+                    float m = c.morph * 2.0f;
+                    return v2 * (1.0f - m) + v1 * m;
+                }
+                else
+                {
+                    float m = (c.morph - 0.5f) * 2.0f;
+                    return v1 * (1.0f - m) + (x - c.k_val * v1 - v2) * m;
+                }
+            case FilterType::Formant:
+                break;
+        }
+        return 0;
+    }
     
     AetherFilter() { reset(); }
 
@@ -41,6 +164,14 @@ public:
         }
     }
 
+    /** Times the stability guards cleared the state since the last call. Audio thread. */
+    int takeRecoveries()
+    {
+        const int n = recoveries;
+        recoveries = 0;
+        return n;
+    }
+
     /**
      * Set filter coefficients
      * @param cutoff Frequency in Hz
@@ -49,18 +180,13 @@ public:
      */
     void setParams(float cutoff, float res, float morph)
     {
-        cutoff = std::clamp(cutoff, 20.0f, sampleRate * 0.45f);
-        currentCutoff = cutoff;
-        currentResonance = res;
-        currentMorph = std::clamp(morph, 0.0f, 0.999f); 
-        
-        float g = std::tan(PI * cutoff / sampleRate);
-        float r = 2.0f - (1.95f * res); 
-        
-        a1 = 1.0f / (1.0f + g * (g + r));
-        a2 = g * a1;
-        a3 = g * a2;
-        k_val = r;
+        coeffs.set(cutoff, res, morph, sampleRate);
+    }
+
+    /** Takes another instance's coefficients (a stereo pair needs setParams() only once). */
+    void copyParamsFrom(const AetherFilter& other)
+    {
+        coeffs = other.coeffs;
     }
 
     SampleType processSample(SampleType x)
@@ -70,111 +196,36 @@ public:
         if (!std::isfinite(x) || !std::isfinite(s1) || !std::isfinite(s2)) 
         {
             reset();
+            ++recoveries;
             return 0.0f; // Silence this sample
         }
 
         // Standard SVF State Update
         SampleType v3 = x - s2;
-        SampleType v1 = a1 * s1 + a2 * v3;
-        SampleType v2 = s2 + a3 * s1 + a2 * v1;
+        SampleType v1 = coeffs.a1 * s1 + coeffs.a2 * v3;
+        SampleType v2 = s2 + coeffs.a3 * s1 + coeffs.a2 * v1;
         
         s1 = 2.0f * v1 - s1;
         s2 = 2.0f * v2 - s2;
-        
-        SampleType output = 0;
 
-        switch (filterType)
-        {
-            case FilterType::LowPass:
-                output = v2;
-                break;
-            case FilterType::BandPass:
-                output = v1;
-                break;
-            case FilterType::HighPass:
-                output = x - k_val * v1 - v2;
-                break;
-            case FilterType::Notch:
-                output = x - k_val * v1;
-                break;
-            case FilterType::Morph:
-                // Morphing between LP -> BP -> HP
-                if (currentMorph < 0.5f)
-                {
-                    float m = currentMorph * 2.0f;
-                    output = v2 * (1.0f - m) + v1 * m;
-                }
-                else
-                {
-                    float m = (currentMorph - 0.5f) * 2.0f;
-                    output = v1 * (1.0f - m) + (x - k_val * v1 - v2) * m;
-                }
-                break;
-            case FilterType::Formant:
-            {
-                // Safety: Reset Formant states if invalid
-                if (!std::isfinite(ic1eq) || !std::isfinite(ic3eq)) reset();
-
-                struct Vowel { float f1, f2, f3; };
-                static const Vowel vowelTable[5] = {
-                    { 730.0f, 1090.0f, 2440.0f }, // A
-                    { 530.0f, 1840.0f, 2480.0f }, // E
-                    { 270.0f, 2290.0f, 3010.0f }, // I
-                    { 570.0f, 840.0f,  2410.0f }, // O
-                    { 300.0f, 870.0f,  2240.0f }  // U
-                };
-                
-                float m = currentMorph * 3.99f;
-                int i = (int)m;
-                float frac = m - i;
-                int next = (i + 1) % 5;
-                
-                float f1 = vowelTable[i].f1 * (1.0f - frac) + vowelTable[next].f1 * frac;
-                float f2 = vowelTable[i].f2 * (1.0f - frac) + vowelTable[next].f2 * frac;
-                float f3 = vowelTable[i].f3 * (1.0f - frac) + vowelTable[next].f3 * frac;
-                
-                float shift = std::pow(currentCutoff / 800.0f, 0.5f); 
-                f1 *= shift; f2 *= shift; f3 *= shift;
-                
-                float q = 1.0f + (currentResonance * 15.0f); 
-                
-                auto processPeak = [&](float freq, SampleType& sA, SampleType& sB) -> SampleType
-                {
-                    freq = std::clamp(freq, 40.0f, sampleRate * 0.45f);
-                    float gp = std::tan(PI * freq / sampleRate);
-                    float rp = 1.0f / q;
-                    float a1p = 1.0f / (1.0f + gp * (gp + rp));
-                    float a2p = gp * a1p;
-                    float a3p = gp * a2p;
-
-                    SampleType v3p = x - sB;
-                    SampleType v1p = a1p * sA + a2p * v3p;
-                    SampleType v2p = sB + a3p * sA + a2p * v1p;
-                    
-                    sA = 2.0f * v1p - sA;
-                    sB = 2.0f * v2p - sB;
-                    
-                    return v1p; // Bandpass output
-                };
-
-                SampleType p1 = processPeak(f1, ic1eq, ic2eq);
-                SampleType p2 = processPeak(f2, ic3eq, ic4eq);
-                SampleType p3 = processPeak(f3, ic5eq, ic6eq);
-                
-                // Sum formant peaks; gain compensation so Vowel mode isn't much quieter than Morph
-                output = (p1 * 1.0f + p2 * 0.8f + p3 * 0.6f) * 0.8f;
-                const float formantGainComp = 3.5f; // Formant is very selective, restore level
-                output = std::tanh(output * formantGainComp);
-                break;
-            }
-        }
-        return output;
+        if (filterType != FilterType::Formant)
+            return svfOutput(filterType, coeffs, x, v1, v2);
+
+        // Safety: Reset Formant states if invalid
+        if (!std::isfinite(ic1eq) || !std::isfinite(ic3eq)) { reset(); ++recoveries; }
+
+        Peak peaks[3];
+        formantPeaks(coeffs, sampleRate, peaks);
+
+        SampleType p1 = processPeak(peaks[0], x, ic1eq, ic2eq);
+        SampleType p2 = processPeak(peaks[1], x, ic3eq, ic4eq);
+        SampleType p3 = processPeak(peaks[2], x, ic5eq, ic6eq);
+        return formantOutput(p1, p2, p3);
     }
 
 private:
     float sampleRate = 44100.0f;
-    float a1=0, a2=0, a3=0;
-    float k_val = 1.0f;
+    Coefficients coeffs;
     SampleType s1 = 0, s2 = 0;
     
     // Formant Filter State
@@ -182,11 +233,120 @@ private:
     SampleType ic3eq = 0, ic4eq = 0;
     SampleType ic5eq = 0, ic6eq = 0;
     
-    float currentCutoff = 1000.0f;
-    float currentResonance = 0.5f;
-    float currentMorph = 0.0f;
-    
     FilterType filterType = FilterType::Morph;
+    int recoveries = 0; // Guard trips since takeRecoveries()
+};
+
+/**
+ * AetherFilter over interleaved frames of up to maxLanes channels. The
+ * coefficients, and in Formant mode the three peaks, are computed once per
+ * frame for every lane; each lane keeps its own state and guards, and
+ * matches its own AetherFilter sample for sample.
+ */
+template <typename SampleType>
+class AetherLaneFilter
+{
+public:
+    static constexpr int maxLanes = 8;
+    using Filter = AetherFilter<SampleType>;
+    using FilterType = typename Filter::FilterType;
+
+    void prepare(const juce::dsp::ProcessSpec& spec)
+    {
+        sampleRate = (float)spec.sampleRate;
+        reset();
+    }
+
+    void reset()
+    {
+        for (int k = 0; k < maxLanes; ++k)
+            resetLane(k);
+    }
+
+    void setType(FilterType t)
+    {
+        if (filterType != t)
+        {
+            filterType = t;
+            reset(); // Clear state when switching modes
+        }
+    }
+
+    int takeRecoveries()
+    {
+        const int n = recoveries;
+        recoveries = 0;
+        return n;
+    }
+
+    void setParams(float cutoff, float res, float morph)
+    {
+        coeffs.set(cutoff, res, morph, sampleRate);
+    }
+
+    /** Filters one frame of Lanes channels in place. */
+    template <int Lanes>
+    void processFrame(SampleType* x)
+    {
+        // A lane whose guard trips restarts from silence: cleared state fed 0 gives
+        // exactly the 0 AetherFilter returns, so the lane loops below need no test.
+        for (int k = 0; k < Lanes; ++k)
+        {
+            if (!std::isfinite(x[k]) || !std::isfinite(s1[k]) || !std::isfinite(s2[k]))
+            {
+                resetLane(k);
+                ++recoveries;
+                x[k] = 0;
+            }
+        }
+
+        SampleType v1[Lanes], v2[Lanes];
+
+        for (int k = 0; k < Lanes; ++k)
+        {
+            SampleType v3 = x[k] - s2[k];
+            v1[k] = coeffs.a1 * s1[k] + coeffs.a2 * v3;
+            v2[k] = s2[k] + coeffs.a3 * s1[k] + coeffs.a2 * v1[k];
+
+            s1[k] = 2.0f * v1[k] - s1[k];
+            s2[k] = 2.0f * v2[k] - s2[k];
+        }
+
+        if (filterType != FilterType::Formant)
+        {
+            for (int k = 0; k < Lanes; ++k)
+                x[k] = Filter::svfOutput(filterType, coeffs, x[k], v1[k], v2[k]);
+            return;
+        }
+
+        typename Filter::Peak peaks[3];
+        Filter::formantPeaks(coeffs, sampleRate, peaks);
+
+        for (int k = 0; k < Lanes; ++k)
+        {
+            if (!std::isfinite(ic[0][k]) || !std::isfinite(ic[2][k])) { resetLane(k); ++recoveries; }
+
+            SampleType p1 = Filter::processPeak(peaks[0], x[k], ic[0][k], ic[1][k]);
+            SampleType p2 = Filter::processPeak(peaks[1], x[k], ic[2][k], ic[3][k]);
+            SampleType p3 = Filter::processPeak(peaks[2], x[k], ic[4][k], ic[5][k]);
+            x[k] = Filter::formantOutput(p1, p2, p3);
+        }
+    }
+
+private:
+    void resetLane(int k)
+    {
+        s1[k] = 0; s2[k] = 0;
+        for (auto& state : ic) state[k] = 0;
+    }
+
+    float sampleRate = 44100.0f;
+    typename Filter::Coefficients coeffs;
+    SampleType s1[maxLanes] {}, s2[maxLanes] {};
+    SampleType ic[6][maxLanes] {}; // Formant peaks: ic1eq..ic6eq per lane
+
+    FilterType filterType = FilterType::Morph;
+    int recoveries = 0;
 };
 
 } // namespace aether
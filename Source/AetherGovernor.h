@@ -0,0 +1,123 @@
+/*
+  ==============================================================================
+
+    AetherGovernor.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Opt-in CPU-budget governor.
+
+    Each block's processing time is measured against the block's real-time
+    budget (numSamples / sampleRate). Sustained overload steps the engine
+    down one quality tier at a time; sustained headroom steps it back up.
+    The two thresholds are far apart and both need time to accumulate, so a
+    single slow block (GC, page fault, UI burst) never changes anything.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace aether
+{
+
+/**
+ * QualityTier: one rung of the degradation ladder.
+ */
+struct QualityTier
+{
+    int controlInterval = 1;  // Filter coefficients recomputed every N oversampled samples
+    bool forceEco = false;    // 2x oversampling regardless of the user's quality setting
+    int maxStages = 12;       // Cap on distortion stages
+
+    /**
+     * The ladder, cheapest loss first: coarser control rate (inaudible on
+     * most material), then 2x oversampling (more aliasing up top), then
+     * fewer distortion stages (changes the tone, so last).
+     */
+    static QualityTier get(int index)
+    {
+        switch (index)
+        {
+            case 0:  return { 1, false, 12 };
+            case 1:  return { 4, false, 12 };
+            case 2:  return { 4, true, 12 };
+            default: return { 4, true, 4 };
+        }
+    }
+
+    static constexpr int numTiers = 4;
+};
+
+/**
+ * QualityGovernor: block timings in, tier out. Audio thread only.
+ */
+class QualityGovernor
+{
+public:
+    // Smoothed load (processing time / budget) above which a block counts as overloaded
+    static constexpr double overloadLoad = 0.75;
+    // ...and below which it counts as headroom
+    static constexpr double headroomLoad = 0.35;
+
+    // Audio time the condition must hold before stepping down / up
+    static constexpr double stepDownSeconds = 0.25;
+    static constexpr double stepUpSeconds = 3.0;
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        reset();
+    }
+
+    void reset()
+    {
+        tier = 0;
+        load = 0.0;
+        overloadTime = 0.0;
+        headroomTime = 0.0;
+    }
+
+    /** Feeds one block's wall-clock processing time. Returns the tier for the next block. */
+    int update(double elapsedSeconds, int numSamples)
+    {
+        if (numSamples <= 0 || sampleRate <= 0.0) return tier;
+
+        const double budget = numSamples / sampleRate;
+
+        // One-pole smoothing over roughly 50 ms of audio, independent of block size
+        const double alpha = juce::jmin(1.0, budget / 0.05);
+        load += alpha * (elapsedSeconds / budget - load);
+
+        overloadTime = load > overloadLoad ? overloadTime + budget : 0.0;
+        headroomTime = load < headroomLoad ? headroomTime + budget : 0.0;
+
+        if (overloadTime >= stepDownSeconds && tier < QualityTier::numTiers - 1)
+        {
+            ++tier;
+            overloadTime = 0.0; // Give the new tier time to show its effect
+        }
+        else if (headroomTime >= stepUpSeconds && tier > 0)
+        {
+            --tier;
+            headroomTime = 0.0;
+        }
+
+        return tier;
+    }
+
+    int getTier() const { return tier; }
+    double getLoad() const { return load; }
+
+private:
+    double sampleRate = 44100.0;
+    int tier = 0;
+    double load = 0.0;
+    double overloadTime = 0.0;
+    double headroomTime = 0.0;
+};
+
+} // namespace aether
@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+    AetherHealth.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Engine health: how often an instance heals itself, and why.
+
+    The audio thread reports events: watchdog resets, guard recoveries,
+    output clipping, sleep, governor tier changes. Each kind has a running
+    counter, and each event also goes into a small timestamped ring. Both
+    can be read from any thread without locking, by the UI and when the
+    host saves the state.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+
+namespace aether
+{
+
+enum class HealthEvent
+{
+    Reset,          // Requested from the message thread (state load, panic)
+    NanRecovery,    // NaN watchdog: non-finite output, engine reset
+    RailTrip,       // Output stuck at the rails for a quarter of a block, engine reset
+    ModuleRecovery, // A filter, resonator or noise guard cleared its own state (value: how many)
+    Clip,           // Output samples at or above full scale (counts samples; events mark the start of a run)
+    Sleep,
+    Wake,
+    QualityDown,    // CPU governor stepped down (value: the new tier)
+    QualityUp,
+    Count
+};
+
+inline const char* getHealthEventName(HealthEvent event)
+{
+    static const char* const names[] = { "reset", "nanRecovery", "railTrip", "moduleRecovery", "clip",
+                                         "sleep", "wake", "qualityDown", "qualityUp" };
+    static_assert(sizeof(names) / sizeof(names[0]) == (size_t)HealthEvent::Count, "One name per event");
+    return names[(int)event];
+}
+
+/**
+ * HealthMonitor: one per processor. One writer (the audio thread), any
+ * number of readers.
+ */
+class HealthMonitor
+{
+public:
+    static constexpr int numEvents = (int)HealthEvent::Count;
+    static constexpr int capacity = 256; // Events kept in the ring
+
+    struct Entry
+    {
+        juce::int64 timeMs = 0; // Wall clock (juce::Time::currentTimeMillis)
+        HealthEvent event = HealthEvent::Reset;
+        int group = -1;         // Engine group, -1 for the processor
+        int value = 0;
+    };
+
+    // --- Audio thread ---
+
+    /** Counts `value` and logs the event. */
+    void report(HealthEvent event, int value, int group)
+    {
+        count(event, value);
+
+        const auto w = written.load(std::memory_order_relaxed);
+        ring[w & (capacity - 1)] = { juce::Time::currentTimeMillis(), event, group, value };
+        written.store(w + 1, std::memory_order_release);
+    }
+
+    /** Counts without logging (clipped samples inside a run). */
+    void count(HealthEvent event, int value)
+    {
+        auto& c = counters[(size_t)event];
+        c.store(c.load(std::memory_order_relaxed) + (juce::uint64)value, std::memory_order_relaxed);
+    }
+
+    // --- Any thread ---
+
+    juce::uint64 getCount(HealthEvent event) const { return counters[(size_t)event].load(std::memory_order_relaxed); }
+
+    /** Events since this instance was created. */
+    juce::uint32 getNumEvents() const { return written.load(std::memory_order_acquire); }
+
+    /**
+     * Copies up to maxEntries of the newest events into dest, oldest first,
+     * and returns how many. Reads at most half the ring, so an event the
+     * writer overwrites meanwhile is detected and dropped.
+     */
+    int getRecent(Entry* dest, int maxEntries) const
+    {
+        const auto end = written.load(std::memory_order_acquire);
+        const auto n = juce::jmin((juce::uint32)juce::jmax(0, maxEntries), end, (juce::uint32)capacity / 2);
+        const auto first = end - n;
+
+        for (juce::uint32 i = 0; i < n; ++i)
+            dest[i] = ring[(first + i) & (capacity - 1)];
+
+        // Slots the writer has reached since (including the one it may be writing) were overwritten
+        const auto next = written.load(std::memory_order_acquire) + 1;
+        const auto lost = next > first + capacity ? juce::jmin(n, next - first - capacity) : 0u;
+
+        for (juce::uint32 i = lost; i < n; ++i)
+            dest[i - lost] = dest[i];
+
+        return (int)(n - lost);
+    }
+
+private:
+    std::array<std::atomic<juce::uint64>, numEvents> counters {};
+    std::array<Entry, capacity> ring {};
+    std::atomic<juce::uint32> written { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (HealthMonitor)
+};
+
+} // namespace aether
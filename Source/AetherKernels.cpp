@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    AetherKernels.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Runtime selection of the kernel table (see AetherKernels.h).
+
+  ==============================================================================
+*/
+
+#include "AetherKernels.h"
+#include <juce_core/juce_core.h>
+
+namespace aether
+{
+namespace kernels
+{
+
+#if JUCE_INTEL
+namespace sse2   { extern const KernelTable table; }
+namespace avx2   { extern const KernelTable table; }
+namespace avx512 { extern const KernelTable table; }
+#elif JUCE_ARM
+namespace neon   { extern const KernelTable table; }
+#endif
+
+#if JUCE_INTEL
+/**
+ * GCC and Clang build the AVX-512 unit with -mavx512f only, but MSVC's
+ * /arch:AVX512 also emits BW, DQ and VL instructions: the unit runs only
+ * where all four are present (every AVX-512 CPU but Xeon Phi).
+ */
+static bool hasAVX512()
+{
+    return juce::SystemStats::hasAVX512F() && juce::SystemStats::hasAVX512BW()
+        && juce::SystemStats::hasAVX512DQ() && juce::SystemStats::hasAVX512VL();
+}
+
+// The AVX2 unit is built with -mavx2 -mfma (/arch:AVX2 on MSVC)
+static bool hasAVX2()
+{
+    return juce::SystemStats::hasAVX2() && juce::SystemStats::hasFMA3();
+}
+#endif
+
+static const KernelTable& select()
+{
+   #if JUCE_INTEL
+    if (hasAVX512())
+        return avx512::table;
+
+    if (hasAVX2())
+        return avx2::table;
+
+    return sse2::table;
+   #elif JUCE_ARM
+    return neon::table;
+   #endif
+}
+
+const KernelTable& get()
+{
+    static const KernelTable& selected = select(); // Thread-safe static init, first call only
+    return selected;
+}
+
+int getAvailable(const KernelTable* (&tables)[maxTables])
+{
+    int count = 0;
+
+   #if JUCE_INTEL
+    if (hasAVX512())
+        tables[count++] = &avx512::table;
+
+    if (hasAVX2())
+        tables[count++] = &avx2::table;
+
+    tables[count++] = &sse2::table;
+   #elif JUCE_ARM
+    tables[count++] = &neon::table;
+   #endif
+
+    return count;
+}
+
+} // namespace kernels
+} // namespace aether
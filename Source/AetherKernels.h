@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    AetherKernels.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Data-parallel block kernels with runtime ISA dispatch.
+
+    The kernels are written once (AetherKernelsImpl.h) as plain loops and
+    compiled several times, each translation unit with its own target flags
+    (AetherKernels_SSE2.cpp, _AVX2.cpp, _AVX512.cpp, _NEON.cpp). get() picks
+    the best table the CPU supports the first time it is called, so the
+    binary still runs on baseline x86-64 while newer machines get wider
+    vectors. Every ISA produces bit-identical results (no FMA contraction).
+
+    Only loops without a sample-to-sample dependency live here, among them
+    the high band's distortion and the output saturation. The SVFs,
+    crossover, followers, DC blocker and resonator are recursive in time and
+    stay scalar in the engine. Transcendentals (sin, atan, tanh, pow) call
+    the same libm functions as the scalar code in every ISA, so only the
+    arithmetic around them is widened, and the kernels match the scalar
+    path (AetherDistortion::processSample, std::tanh) bit for bit.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace aether
+{
+namespace kernels
+{
+
+struct KernelTable
+{
+    const char* isaName;
+
+    /** out[i] = (|l[i]| + |r[i]|) * 0.5. r may be nullptr (a silent right channel). */
+    void (*inputEnergy)(const float* l, const float* r, float* out, int numSamples);
+
+    /**
+     * In-place squeeze: x *= 1 + (1 / sqrt(|x| + 0.01) - 1) * amount.
+     * amount[i / hold] per sample if amount is non-null, else constantAmount.
+     */
+    void (*squeeze)(float* x, int numSamples, const float* amount, float constantAmount, int hold);
+
+    /** Number of samples with |x| >= threshold. */
+    int (*countAbove)(const float* x, int numSamples, float threshold);
+
+    /** wet = wet * mix + dry * (1 - mix); mix per sample if non-null, else constantMix. */
+    void (*dryWetMix)(float* wet, const float* dry, const float* mix, float constantMix, int numSamples);
+
+    /**
+     * In place, AetherDistortion::processSample around a DC tilt:
+     * x = distort(x + tilt, drive, fold) - tilt, per sample drive and tilt.
+     * fold[i / hold] per sample if fold is non-null, else constantFold.
+     * algoPos / algoNeg are DistortionAlgo values.
+     */
+    void (*distortion)(float* x, const float* drive, const float* tilt, const float* fold, float constantFold,
+                       int hold, int numSamples, int algoPos, int algoNeg, int stages);
+
+    /** out[i] = tanh(low[i] + high[i]): the band sum into the output saturation. out may alias either input. */
+    void (*sumSaturate)(float* out, const float* low, const float* high, int numSamples);
+};
+
+/** The best table for this CPU. Chosen once, safe to call from any thread. */
+const KernelTable& get();
+
+static constexpr int maxTables = 3;
+
+/** Every table this CPU can run, best first (get() is the first). Returns how many; for tests and benchmarks. */
+int getAvailable(const KernelTable* (&tables)[maxTables]);
+
+} // namespace kernels
+} // namespace aether
@@ -0,0 +1,233 @@
+/*
+  ==============================================================================
+
+    AetherKernelsImpl.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Kernel bodies, included once per ISA translation unit.
+
+    Define AETHER_KERNEL_ISA (a namespace name) before including. Nothing here
+    may call an inline function from another header: the linker keeps one copy
+    of each inline function, and if that copy came from the AVX2 unit it would
+    run on machines without AVX2. Everything is file-local for that reason.
+
+  ==============================================================================
+*/
+
+#ifndef AETHER_KERNEL_ISA
+ #error "Define AETHER_KERNEL_ISA before including AetherKernelsImpl.h"
+#endif
+
+#include "AetherKernels.h"
+
+// The same libm entry points std:: calls for float: identical results in every ISA
+#if defined(__GNUC__) || defined(__clang__)
+ #define AETHER_KERNEL_SQRT(x) __builtin_sqrtf(x)
+ #define AETHER_KERNEL_SIN(x) __builtin_sinf(x)
+ #define AETHER_KERNEL_ATAN(x) __builtin_atanf(x)
+ #define AETHER_KERNEL_TANH(x) __builtin_tanhf(x)
+ #define AETHER_KERNEL_POW(x, y) __builtin_powf(x, y)
+ #define AETHER_KERNEL_FLOOR(x) __builtin_floorf(x)
+ #define AETHER_KERNEL_ROUND(x) __builtin_roundf(x)
+#else
+ #include <math.h>
+ #define AETHER_KERNEL_SQRT(x) sqrtf(x)
+ #define AETHER_KERNEL_SIN(x) sinf(x)
+ #define AETHER_KERNEL_ATAN(x) atanf(x)
+ #define AETHER_KERNEL_TANH(x) tanhf(x)
+ #define AETHER_KERNEL_POW(x, y) powf(x, y)
+ #define AETHER_KERNEL_FLOOR(x) floorf(x)
+ #define AETHER_KERNEL_ROUND(x) roundf(x)
+#endif
+
+namespace aether
+{
+namespace kernels
+{
+namespace AETHER_KERNEL_ISA
+{
+namespace
+{
+
+inline float absf(float x) { return x < 0.0f ? -x : x; }
+
+// std::clamp's comparisons, so NaN passes through exactly as it does there
+inline float clampf(float x, float lo, float hi) { return x < lo ? lo : (hi < x ? hi : x); }
+
+void inputEnergy(const float* l, const float* r, float* out, int numSamples)
+{
+    if (r == nullptr)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            out[i] = (absf(l[i]) + 0.0f) * 0.5f;
+        return;
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = (absf(l[i]) + absf(r[i])) * 0.5f;
+}
+
+void squeeze(float* x, int numSamples, const float* amount, float constantAmount, int hold)
+{
+    if (amount == nullptr)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float gain = 1.0f / AETHER_KERNEL_SQRT(absf(x[i]) + 0.01f);
+            x[i] *= (1.0f + (gain - 1.0f) * constantAmount);
+        }
+        return;
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float gain = 1.0f / AETHER_KERNEL_SQRT(absf(x[i]) + 0.01f);
+        x[i] *= (1.0f + (gain - 1.0f) * amount[i / hold]);
+    }
+}
+
+int countAbove(const float* x, int numSamples, float threshold)
+{
+    int count = 0;
+    for (int i = 0; i < numSamples; ++i)
+        count += absf(x[i]) >= threshold ? 1 : 0;
+    return count;
+}
+
+void dryWetMix(float* wet, const float* dry, const float* mix, float constantMix, int numSamples)
+{
+    if (mix == nullptr)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            wet[i] = wet[i] * constantMix + dry[i] * (1.0f - constantMix);
+        return;
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+        wet[i] = wet[i] * mix[i] + dry[i] * (1.0f - mix[i]);
+}
+
+//==============================================================================
+// Distortion: AetherDistortion::processSample, one pass per stage over a chunk.
+// The algorithm is fixed per block, so each pass is a straight loop over one
+// transfer function instead of a switch per sample and stage.
+
+constexpr int chunkSize = 64;
+constexpr float pi = 3.14159265358979323846f; // AetherCommon's PI
+
+// DistortionAlgo values
+enum Algo { None, SoftClip, HardClip, SineFold, TriangleWarp, BitCrush,
+            SampleReduce, AsymSaturation, Rectify, Tanh, SoftFold, Chebyshev };
+
+/** y = fn(y) where positive[i] == side (side < 0: everywhere). */
+template <typename Fn>
+void applyWhere(float* y, const bool* positive, int side, int n, Fn fn)
+{
+    if (side < 0)
+    {
+        for (int i = 0; i < n; ++i)
+            y[i] = fn(y[i]);
+        return;
+    }
+
+    for (int i = 0; i < n; ++i)
+        if (positive[i] == (side == 1))
+            y[i] = fn(y[i]);
+}
+
+void applyAlgo(int algo, float* y, const bool* positive, int side, int n)
+{
+    switch (algo)
+    {
+        case SoftClip:     applyWhere(y, positive, side, n, [](float x) { return AETHER_KERNEL_ATAN(x); }); break;
+        case HardClip:     applyWhere(y, positive, side, n, [](float x) { return clampf(x, -1.0f, 1.0f); }); break;
+        case SineFold:     applyWhere(y, positive, side, n, [](float x) { return AETHER_KERNEL_SIN(x * pi * 0.5f); }); break;
+        case SoftFold:     applyWhere(y, positive, side, n, [](float x) { return x - (0.1f * AETHER_KERNEL_SIN(x * pi)); }); break;
+        case TriangleWarp: applyWhere(y, positive, side, n, [](float x) { return 2.0f * absf(x - AETHER_KERNEL_FLOOR(x + 0.5f)) - 1.0f; }); break;
+        case BitCrush:     applyWhere(y, positive, side, n, [](float x) { return AETHER_KERNEL_ROUND(x / 0.1f) * 0.1f; }); break;
+        case Rectify:      applyWhere(y, positive, side, n, [](float x) { return absf(x); }); break;
+        case Tanh:         applyWhere(y, positive, side, n, [](float x) { return AETHER_KERNEL_TANH(x); }); break;
+        case Chebyshev:    applyWhere(y, positive, side, n, [](float x) { return (4.0f * x * x * x) - (3.0f * x); }); break;
+        default:           break; // None and the unimplemented ones pass through
+    }
+}
+
+void distortion(float* x, const float* drive, const float* tilt, const float* fold, float constantFold,
+                int hold, int numSamples, int algoPos, int algoNeg, int stages)
+{
+    const float stageScale = AETHER_KERNEL_SQRT((float)stages);
+    float y[chunkSize], gain[chunkSize];
+    bool positive[chunkSize];
+
+    for (int start = 0; start < numSamples; start += chunkSize)
+    {
+        const int n = numSamples - start < chunkSize ? numSamples - start : chunkSize;
+
+        for (int i = 0; i < n; ++i)
+        {
+            const int s = start + i;
+            const float f = fold != nullptr ? fold[s / hold] : constantFold;
+            float v = x[s] + tilt[s];
+
+            // Pre-folding
+            if (f > 0.001f)
+            {
+                const float foldGain = 1.0f + (f * 4.0f);
+                v = AETHER_KERNEL_SIN(v * foldGain * pi * 0.5f);
+            }
+
+            y[i] = v;
+            gain[i] = AETHER_KERNEL_POW(10.0f, (drive[s] * 24.0f) / 20.0f) / stageScale;
+        }
+
+        for (int stage = 0; stage < stages; ++stage)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                y[i] *= gain[i];
+                positive[i] = y[i] >= 0.0f;
+            }
+
+            if (algoPos == algoNeg)
+            {
+                applyAlgo(algoPos, y, positive, -1, n);
+            }
+            else
+            {
+                applyAlgo(algoPos, y, positive, 1, n);
+                applyAlgo(algoNeg, y, positive, 0, n);
+            }
+
+            for (int i = 0; i < n; ++i)
+                y[i] = clampf(y[i], -2.0f, 2.0f);
+        }
+
+        for (int i = 0; i < n; ++i)
+            x[start + i] = y[i] - tilt[start + i];
+    }
+}
+
+void sumSaturate(float* out, const float* low, const float* high, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = AETHER_KERNEL_TANH(low[i] + high[i]);
+}
+
+} // namespace
+
+extern const KernelTable table;
+const KernelTable table { AETHER_KERNEL_ISA_NAME, inputEnergy, squeeze, countAbove, dryWetMix, distortion, sumSaturate };
+
+} // namespace AETHER_KERNEL_ISA
+} // namespace kernels
+} // namespace aether
+
+#undef AETHER_KERNEL_SQRT
+#undef AETHER_KERNEL_SIN
+#undef AETHER_KERNEL_ATAN
+#undef AETHER_KERNEL_TANH
+#undef AETHER_KERNEL_POW
+#undef AETHER_KERNEL_FLOOR
+#undef AETHER_KERNEL_ROUND
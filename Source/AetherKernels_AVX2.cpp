@@ -0,0 +1,20 @@
+/*
+  ==============================================================================
+
+    AetherKernels_AVX2.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Built with AVX2 flags from CMake (FP contraction off, so results match SSE2).
+
+  ==============================================================================
+*/
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#define AETHER_KERNEL_ISA avx2
+#define AETHER_KERNEL_ISA_NAME "AVX2"
+#include "AetherKernelsImpl.h"
+
+#endif
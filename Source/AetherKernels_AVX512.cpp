@@ -0,0 +1,20 @@
+/*
+  ==============================================================================
+
+    AetherKernels_AVX512.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Built with AVX-512F flags from CMake.
+
+  ==============================================================================
+*/
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#define AETHER_KERNEL_ISA avx512
+#define AETHER_KERNEL_ISA_NAME "AVX512"
+#include "AetherKernelsImpl.h"
+
+#endif
@@ -0,0 +1,20 @@
+/*
+  ==============================================================================
+
+    AetherKernels_NEON.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    ARM build: NEON is part of the AArch64 baseline, so no extra flags.
+
+  ==============================================================================
+*/
+
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+
+#define AETHER_KERNEL_ISA neon
+#define AETHER_KERNEL_ISA_NAME "NEON"
+#include "AetherKernelsImpl.h"
+
+#endif
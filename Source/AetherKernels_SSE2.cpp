@@ -0,0 +1,20 @@
+/*
+  ==============================================================================
+
+    AetherKernels_SSE2.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Baseline x86 build: the fallback every x86-64 CPU can run.
+
+  ==============================================================================
+*/
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+#define AETHER_KERNEL_ISA sse2
+#define AETHER_KERNEL_ISA_NAME "SSE2"
+#include "AetherKernelsImpl.h"
+
+#endif
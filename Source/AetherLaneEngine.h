@@ -0,0 +1,827 @@
+/*
+  ==============================================================================
+
+    AetherLaneEngine.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    The AetherEngine chain for a whole multichannel bus (quad, 5.x, 7.x,
+    discrete) with every channel's state packed into the lanes of one
+    vector.
+
+    A tile is interleaved frames, one lane per bus channel, and every
+    per-channel stage (crossover, oversampler, fold, distortion, filter,
+    resonator, squeeze, output) runs all lanes at once. Coefficients and
+    per-frame control work (filter and formant design, resonator read
+    position, ramps, modulation) are computed once for the bus, the way a
+    stereo engine shares them between L and R, so eight channels cost a
+    little over two stereo ones instead of four.
+
+    Noise and dimension stay pairwise: each unit (a left/right pair or a
+    lone channel) has its own generator, gate and width stage, seeded apart
+    so the pairs stay decorrelated. Flux and chaos modulation follow the
+    whole bus.
+
+    Two lanes forming one unit match AetherEngine<float, 2> bit for bit;
+    mono and stereo buses still run that engine (see AetherBusEngine).
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherDSP.h"
+#include <vector>
+
+namespace aether
+{
+
+class AetherLaneEngine
+{
+public:
+    static constexpr int maxLanes = 8;
+    static constexpr int tileSize = AETHER_TILE_SIZE;
+    static constexpr float silenceThreshold = AetherEngine<float>::silenceThreshold;
+
+    /** A pair of lanes (or one: right == -1) sharing a noise generator and a dimension stage. */
+    struct Unit
+    {
+        int left = 0;
+        int right = -1;
+    };
+
+    /**
+     * Message thread. One lane per channel of spec (2 to maxLanes); every
+     * lane belongs to exactly one of `units`.
+     */
+    void prepare(const juce::dsp::ProcessSpec& spec, const std::vector<Unit>& newUnits)
+    {
+        preparedSpec = spec;
+        numLanes = juce::jlimit(2, maxLanes, (int)spec.numChannels);
+        jassert((int)spec.numChannels == numLanes);
+
+        const int maxUp = tileSize * 4;
+        frameTile.assign((size_t)(tileSize * numLanes), 0.0f);
+        lowTile.assign((size_t)(tileSize * numLanes), 0.0f);
+        highTile.assign((size_t)(tileSize * numLanes), 0.0f);
+        splitLow.setSize(numLanes, tileSize);
+        splitHigh.setSize(numLanes, tileSize);
+        fluxTile.assign((size_t)maxUp, 0.0f);
+        chaosTile.assign((size_t)maxUp, 0.0f);
+        driveTile.assign((size_t)(maxUp * numLanes), 0.0f);
+        tiltTile.assign((size_t)(maxUp * numLanes), 0.0f);
+
+        oversampler.prepare(tileSize, numLanes, true);
+
+        // The low band is one interleaved stream: a delay of d frames is d * numLanes values
+        lowDelay.prepare(1, oversampler.getMaxLatencySamples() * numLanes);
+
+        juce::dsp::ProcessSpec oversampledSpec = spec;
+        oversampledSpec.sampleRate = spec.sampleRate * 4.0;
+        oversampledSpec.maximumBlockSize = (juce::uint32)maxUp;
+
+        filter.prepare(oversampledSpec);
+        resonator.prepare(oversampledSpec, numLanes);
+        crossover.prepare(spec.sampleRate);
+        linearCrossover.prepare(spec.sampleRate, numLanes);
+
+        chaosLFO.setParams(0.2f, AetherLFO::Waveform::Drift);
+
+        units.resize(newUnits.size());
+        for (size_t u = 0; u < units.size(); ++u)
+        {
+            auto& unit = units[u];
+            unit.lanes = newUnits[u];
+            jassert(unit.lanes.left < numLanes && unit.lanes.right < numLanes);
+
+            unit.gate.prepare(spec.sampleRate);
+            unit.gate.setParams(5.0f, 30.0f);
+            unit.dimension.prepare(oversampledSpec);
+            unit.noise.prepare(spec.sampleRate);
+            unit.noise.setCustomSample(customNoise);
+        }
+
+        prepareRamps(spec);
+        applyQuality();
+        reset();
+    }
+
+    int getNumLanes() const { return numLanes; }
+
+    /** Audio thread. As AetherEngine::setQuality(). */
+    void setQuality(EngineQuality newQuality)
+    {
+        if (newQuality == quality) return;
+
+        quality = newQuality;
+        applyQuality();
+        reset();
+    }
+
+    EngineQuality getQuality() const { return quality; }
+
+    /** Audio thread. As AetherEngine::setLinearPhase(). */
+    void setLinearPhase(bool shouldBeLinear)
+    {
+        if (shouldBeLinear == linearPhase) return;
+
+        linearPhase = shouldBeLinear;
+        applyQuality();
+        reset();
+    }
+
+    bool isLinearPhase() const { return linearPhase; }
+
+    /** Audio thread. As AetherEngine::setLinearCrossover(); the FFT split runs per lane. */
+    void setLinearCrossover(bool shouldBeLinear)
+    {
+        if (shouldBeLinear == useLinearCrossover) return;
+
+        useLinearCrossover = shouldBeLinear;
+        applyQuality();
+        reset();
+    }
+
+    bool isLinearCrossover() const { return useLinearCrossover; }
+
+    int getLatencySamples() const { return latencySamples; }
+
+    int getMaxLatencySamples() const
+    {
+        return oversampler.getMaxLatencySamples() + linearCrossover.getLatencySamples();
+    }
+
+    /** Audio thread. As AetherEngine::setTier(). */
+    void setTier(int newTier)
+    {
+        pendingTier = juce::jlimit(0, QualityTier::numTiers - 1, newTier);
+    }
+
+    int getTier() const { return tierIndex; }
+
+    /**
+     * Not while processing, after prepare(). Unit u's noise gets seed + 2u and
+     * the chaos LFO seed + 1: one stereo unit repeats AetherEngine exactly.
+     */
+    void setRandomSeed(juce::int64 seed)
+    {
+        for (size_t u = 0; u < units.size(); ++u)
+            units[u].noise.setSeed(seed + 2 * (juce::int64)u);
+
+        chaosLFO.setSeed(seed + 1);
+    }
+
+    /** Audio thread only. Not owned: the caller keeps the buffer alive until it is replaced. */
+    void setCustomNoise(const juce::AudioBuffer<float>* buffer)
+    {
+        customNoise = buffer;
+        for (auto& unit : units)
+            unit.noise.setCustomSample(buffer);
+    }
+
+    /** Not while processing. Watchdog, guard and sleep events go to `h` (nullptr: none), tagged with `group`. */
+    void setHealthMonitor(HealthMonitor* h, int group)
+    {
+        health = h;
+        healthGroup = group;
+    }
+
+    /** Not while processing. Stage timings go to `p` (nullptr: none), tagged with `group`. */
+    void setProfiler(StageProfiler* p, int group)
+    {
+        profiler = p;
+        profileGroup = group;
+    }
+
+    /** Clears every lane's state, as AetherEngine::reset(). */
+    void reset()
+    {
+        filter.reset();
+        resonator.reset();
+        oversampler.reset();
+        lowDelay.reset();
+        linearCrossover.reset();
+        crossover.reset();
+        fluxFollower.reset();
+
+        std::fill(std::begin(foldHold), std::end(foldHold), 0.0f);
+        foldCounter = 0;
+
+        for (auto& unit : units)
+        {
+            unit.gate.reset();
+            unit.dimension.reset();
+        }
+
+        sleeping = false;
+        silentSamples = 0;
+
+        std::fill(std::begin(dcX1), std::end(dcX1), 0.0f);
+        std::fill(std::begin(dcY1), std::end(dcY1), 0.0f);
+    }
+
+    bool isSleeping() const { return sleeping; }
+
+    /**
+     * channels holds getNumLanes() pointers in lane order. A nullptr lane is
+     * idle: it is fed silence and its output dropped (the LFE while it takes
+     * the direct sub path). Sleeps and wakes like AetherEngine::process(), for
+     * the whole bus at once.
+     */
+    void process(float* const* channels, int numSamples, const ParameterSnapshot& params)
+    {
+        const bool inputSilent = isSilent(channels, numSamples);
+
+        if (sleeping)
+        {
+            if (inputSilent)
+            {
+                clear(channels, numSamples);
+                return;
+            }
+
+            sleeping = false;
+            report(HealthEvent::Wake);
+            wakeFade.reset(0.0f);
+            wakeFade.setTarget(1.0f);
+        }
+
+        chaosLFO.setBPM(params.bpm);
+
+        updateTier();
+        ramps.setTargets(params);
+        updatePlan();
+
+        filter.setType(params.vowelMode ? AetherLaneFilter<float>::FilterType::Formant
+                                        : AetherLaneFilter<float>::FilterType::Morph);
+
+        const float safeXOver = std::clamp(params.xover, 60.0f, 300.0f);
+        crossover.setCutoff(safeXOver);
+        linearCrossover.setCutoff(safeXOver);
+
+        int badSamples = 0;
+        int activeLanes = 0;
+        for (int k = 0; k < numLanes; ++k)
+            activeLanes += channels[k] != nullptr ? 1 : 0;
+
+        bool healthy = true;
+        forLanes([&](auto lanes)
+        {
+            constexpr int Lanes = decltype(lanes)::value;
+
+            for (int start = 0; start < numSamples && healthy; start += tileSize)
+            {
+                const int n = juce::jmin(tileSize, numSamples - start);
+                float* frames = frameTile.data();
+
+                for (int k = 0; k < Lanes; ++k)
+                {
+                    const float* in = channels[k] != nullptr ? channels[k] + start : nullptr;
+                    for (int s = 0; s < n; ++s)
+                        frames[s * Lanes + k] = in != nullptr ? in[s] : 0.0f;
+                }
+
+                healthy = processTile<Lanes>(frames, n, params, badSamples);
+
+                for (int k = 0; k < Lanes && healthy; ++k)
+                {
+                    if (float* out = channels[k] != nullptr ? channels[k] + start : nullptr)
+                        for (int s = 0; s < n; ++s)
+                            out[s] = frames[s * Lanes + k];
+                }
+            }
+        });
+
+        if (!healthy)
+        {
+            // WATCHDOG: a NaN reached the output of some lane. Reset everything, output silence.
+            report(HealthEvent::NanRecovery);
+            reset();
+            clear(channels, numSamples);
+            return;
+        }
+
+        // Rail watchdog: more than 25% of the samples pinned at the limiter
+        if (badSamples > (numSamples * activeLanes) / 4)
+        {
+            report(HealthEvent::RailTrip, badSamples);
+            reset();
+        }
+
+        int recovered = filter.takeRecoveries() + resonator.takeRecoveries();
+        for (auto& unit : units)
+            recovered += unit.noise.takeRecoveries();
+        if (recovered > 0)
+            report(HealthEvent::ModuleRecovery, recovered);
+
+        if (inputSilent && isSilent(channels, numSamples))
+        {
+            silentSamples += numSamples;
+            if ((double)silentSamples > AetherEngine<float>::computeTailSeconds(params) * preparedSpec.sampleRate)
+            {
+                sleeping = true;
+                report(HealthEvent::Sleep);
+            }
+        }
+        else
+        {
+            silentSamples = 0;
+        }
+    }
+
+private:
+    struct UnitState
+    {
+        Unit lanes;
+        AetherNoise<float> noise;
+        AetherEnvelopeFollower gate; // Noise gate: tight response (30ms release)
+        AetherDimension dimension;
+    };
+
+    void report(HealthEvent event, int value = 1)
+    {
+        if (health != nullptr) health->report(event, value, healthGroup);
+    }
+
+    /** Calls fn with the lane count as a compile-time constant. */
+    template <typename Fn>
+    void forLanes(Fn&& fn)
+    {
+        switch (numLanes)
+        {
+            case 2:  fn(std::integral_constant<int, 2>()); break;
+            case 3:  fn(std::integral_constant<int, 3>()); break;
+            case 4:  fn(std::integral_constant<int, 4>()); break;
+            case 5:  fn(std::integral_constant<int, 5>()); break;
+            case 6:  fn(std::integral_constant<int, 6>()); break;
+            case 7:  fn(std::integral_constant<int, 7>()); break;
+            default: fn(std::integral_constant<int, 8>()); break;
+        }
+    }
+
+    /**
+     * One tile of interleaved frames through the whole chain, in place.
+     * The stages and their order are AetherEngine::processTile()'s.
+     */
+    template <int Lanes>
+    bool processTile(float* frames, int numSamples, const ParameterSnapshot& params, int& badSamples)
+    {
+        ramps.render(numSamples);
+        StageClock clock(profiler, profileGroup);
+
+        const int stages = juce::jmin(params.stages, tier.maxStages);
+        const auto nType = static_cast<AetherNoise<float>::NoiseType>(params.noiseType);
+        constexpr float laneScale = 1.0f / (float)Lanes;
+
+        // --- NOISE (per unit) and the broadband flux clock ---
+        for (int s = 0; s < numSamples; ++s)
+        {
+            float* frame = frames + s * Lanes;
+
+            float energy = 0.0f;
+            for (int k = 0; k < Lanes; ++k)
+                energy += std::abs(frame[k]);
+            fluxFollower.processSample(energy * laneScale);
+
+            if (plan.noise)
+            {
+                for (auto& unit : units)
+                {
+                    float& left = frame[unit.lanes.left];
+                    float& right = unit.lanes.right >= 0 ? frame[unit.lanes.right] : left;
+
+                    const float envelope = unit.gate.processSample((std::abs(left) + std::abs(right)) * 0.5f);
+                    unit.noise.process(left, right, ramps.noiseLevel.get(s), ramps.noiseWidth.get(s), nType, envelope);
+                }
+            }
+        }
+
+        clock.lap(ProfileStage::Noise);
+
+        // --- SPLIT BANDS ---
+        float* low = lowTile.data();
+        float* high = highTile.data();
+        const int values = numSamples * Lanes;
+
+        if (useLinearCrossover)
+        {
+            // The FFT split is planar: out of the frames and back
+            for (int k = 0; k < Lanes; ++k)
+            {
+                float* h = splitHigh.getWritePointer(k);
+                for (int s = 0; s < numSamples; ++s)
+                    h[s] = frames[s * Lanes + k];
+            }
+
+            linearCrossover.process(splitHigh.getArrayOfReadPointers(), splitLow.getArrayOfWritePointers(),
+                                    splitHigh.getArrayOfWritePointers(), Lanes, numSamples);
+
+            for (int k = 0; k < Lanes; ++k)
+            {
+                const float* l = splitLow.getReadPointer(k);
+                const float* h = splitHigh.getReadPointer(k);
+                for (int s = 0; s < numSamples; ++s)
+                {
+                    low[s * Lanes + k] = l[s];
+                    high[s * Lanes + k] = h[s];
+                }
+            }
+        }
+        else
+        {
+            std::copy(frames, frames + values, high);
+            crossover.process<Lanes>(high, low, numSamples);
+        }
+
+        clock.lap(ProfileStage::Split);
+
+        // --- LOWS (1x): sub saturation per unit ---
+        for (int s = 0; s < numSamples; ++s)
+        {
+            float* frame = low + s * Lanes;
+
+            for (auto& unit : units)
+            {
+                float sl = frame[unit.lanes.left];
+                float sr = unit.lanes.right >= 0 ? frame[unit.lanes.right] : sl;
+                subProcessor.process(sl, sr, ramps.sub.get(s), ramps.drive.get(s));
+                frame[unit.lanes.left] = sl;
+                if (unit.lanes.right >= 0) frame[unit.lanes.right] = sr;
+            }
+        }
+
+        lowDelay.process(low, 0, values);
+        clock.lap(ProfileStage::Lows);
+
+        // --- UPSAMPLE HIGHS ---
+        oversampler.processUpLanes<Lanes>(high, numSamples);
+        clock.lap(ProfileStage::Upsample);
+
+        float* up = oversampler.getUpLanes();
+        const int upSamples = numSamples * oversamplingFactor;
+        const int upValues = upSamples * Lanes;
+        const int hold = oversamplingFactor * Lanes; // Values per 1x ramp step
+
+        // --- HIGHS (oversampled) ---
+        // Modulation follows the whole bus
+        float* flux = fluxTile.data();
+        float* chaos = chaosTile.data();
+
+        for (int s = 0; s < upSamples; ++s)
+        {
+            float energy = 0.0f;
+            for (int k = 0; k < Lanes; ++k)
+                energy += std::abs(up[s * Lanes + k]);
+
+            flux[s] = fluxFollower.processSample(energy * laneScale);
+            chaos[s] = chaosLFO.getNextSample();
+        }
+
+        clock.lap(ProfileStage::Modulation);
+
+        // Fold: one counter for the bus, a held value per lane
+        if (plan.fold)
+        {
+            for (int s = 0; s < upSamples; ++s)
+            {
+                float* frame = up + s * Lanes;
+                float rateReduction = ramps.fold.get(s / oversamplingFactor) * 40.0f * (float)oversamplingFactor;
+                if (rateReduction < 1.0f) rateReduction = 1.0f;
+                foldCounter++;
+                if (foldCounter >= rateReduction)
+                {
+                    foldCounter = 0;
+                    for (int k = 0; k < Lanes; ++k) foldHold[k] = frame[k];
+                }
+                else
+                {
+                    for (int k = 0; k < Lanes; ++k) frame[k] = foldHold[k];
+                }
+            }
+        }
+
+        clock.lap(ProfileStage::Fold);
+
+        // Distortion: one kernel pass over every lane, drive and tilt repeated per lane
+        float* dynDrive = driveTile.data();
+        float* tilt = tiltTile.data();
+
+        for (int s = 0; s < upSamples; ++s)
+        {
+            const int r = s / oversamplingFactor;
+            const float drive = ramps.drive.get(r);
+            const float d = drive + (flux[s] * drive * 0.5f);
+            const float t = (flux[s] * 0.05f) + (chaos[s] * 0.02f * ramps.scramble.get(r));
+
+            for (int k = 0; k < Lanes; ++k)
+            {
+                dynDrive[s * Lanes + k] = d;
+                tilt[s * Lanes + k] = t;
+            }
+        }
+
+        simd.distortion(up, dynDrive, tilt, ramps.fold.getRamp(), ramps.fold.getCurrent(), hold,
+                        upValues, (int)params.algoPos, (int)params.algoNeg, stages);
+
+        for (int s = 0; s < upSamples; ++s)
+        {
+            const int r = s / oversamplingFactor;
+            float* frame = up + s * Lanes;
+
+            if (--controlCountdown <= 0)
+            {
+                controlCountdown = tier.controlInterval;
+                float dynCutoff = ramps.cutoff.get(r) + (chaos[s] * 500.0f * ramps.scramble.get(r));
+                dynCutoff = std::clamp(dynCutoff, 20.0f, 20000.0f);
+                float dynMorph = ramps.morph.get(r) + (flux[s] * 0.2f);
+                filter.setParams(dynCutoff, ramps.res.get(r), dynMorph);
+            }
+
+            filter.processFrame<Lanes>(frame);
+
+            for (int k = 0; k < Lanes; ++k)
+                if (std::abs(frame[k]) > 10.0f) frame[k] = std::tanh(frame[k]); // Safety
+        }
+
+        clock.lap(ProfileStage::DistortionFilter);
+
+        if (plan.resonator)
+        {
+            for (int s = 0; s < upSamples; ++s)
+            {
+                const int r = s / oversamplingFactor;
+                const float scramble = ramps.scramble.get(r);
+                const float dynFb = ramps.fbAmount.get(r) + (flux[s] * 0.1f * scramble);
+                resonator.processFrame<Lanes>(up + s * Lanes, dynFb, ramps.fbTime.get(r), scramble);
+            }
+        }
+
+        clock.lap(ProfileStage::Resonator);
+
+        // Dimension (per unit: a lone channel widens against silence, as in a mono engine)
+        if (plan.dimension)
+        {
+            for (int s = 0; s < upSamples; ++s)
+            {
+                float* frame = up + s * Lanes;
+                const float width = ramps.width.get(s / oversamplingFactor);
+
+                for (auto& unit : units)
+                {
+                    float left = frame[unit.lanes.left];
+                    float right = unit.lanes.right >= 0 ? frame[unit.lanes.right] : 0.0f;
+
+                    unit.dimension.process(left, right, width);
+
+                    frame[unit.lanes.left] = left;
+                    if (unit.lanes.right >= 0) frame[unit.lanes.right] = right;
+                }
+            }
+        }
+
+        clock.lap(ProfileStage::Dimension);
+
+        if (plan.squeeze)
+            simd.squeeze(up, upValues, ramps.squeeze.getRamp(), ramps.squeeze.getCurrent(), hold);
+
+        clock.lap(ProfileStage::Squeeze);
+
+        // --- DOWNSAMPLE HIGHS ---
+        oversampler.processDownLanes<Lanes>(high, numSamples);
+        clock.lap(ProfileStage::Downsample);
+
+        // --- SUM & OUTPUT ---
+        if (highBandGain.render(numSamples))
+        {
+            const float* gain = highBandGain.getRamp();
+            for (int s = 0; s < numSamples; ++s)
+                for (int k = 0; k < Lanes; ++k)
+                    high[s * Lanes + k] *= gain[s];
+        }
+        else if (highBandGain.getCurrent() == 0.0f)
+        {
+            std::fill(high, high + values, 0.0f);
+        }
+
+        simd.sumSaturate(frames, low, high, values);
+
+        // DC block and limiter; any non-finite lane trips the watchdog
+        const float R = 0.9995f;
+
+        for (int s = 0; s < numSamples; ++s)
+        {
+            float* frame = frames + s * Lanes;
+
+            for (int k = 0; k < Lanes; ++k)
+                if (!std::isfinite(frame[k]))
+                    return false;
+
+            for (int k = 0; k < Lanes; ++k)
+            {
+                const float in = frame[k];
+                float out = in - dcX1[k] + R * dcY1[k];
+                dcX1[k] = in; dcY1[k] = out;
+
+                if (out > 2.0f) out = 2.0f;
+                else if (out < -2.0f) out = -2.0f;
+
+                frame[k] = out;
+            }
+        }
+
+        if (wakeFade.render(numSamples))
+        {
+            const float* gain = wakeFade.getRamp();
+            for (int s = 0; s < numSamples; ++s)
+                for (int k = 0; k < Lanes; ++k)
+                    frames[s * Lanes + k] *= gain[s];
+        }
+
+        badSamples += simd.countAbove(frames, values, 1.95f);
+
+        clock.lap(ProfileStage::Output);
+        return true;
+    }
+
+    void prepareRamps(const juce::dsp::ProcessSpec& spec)
+    {
+        const auto lin = ParameterRamp::Shape::Linear;
+        ramps.prepare(spec.sampleRate, tileSize);
+
+        wakeFade.prepare(spec.sampleRate, tileSize, 0.005, lin);
+        wakeFade.reset(1.0f);
+
+        highBandGain.prepare(spec.sampleRate, tileSize, 0.01, lin);
+        highBandGain.reset(1.0f);
+    }
+
+    /** As AetherEngine::updatePlan(): a stage switching off comes back from silence. */
+    void updatePlan()
+    {
+        const auto next = StagePlan::from(ramps);
+
+        if (plan.noise && !next.noise)
+            for (auto& unit : units) unit.gate.reset();
+
+        if (plan.fold && !next.fold)
+        {
+            std::fill(std::begin(foldHold), std::end(foldHold), 0.0f);
+            foldCounter = 0;
+        }
+
+        if (plan.resonator && !next.resonator) resonator.reset();
+
+        if (plan.dimension && !next.dimension)
+            for (auto& unit : units) unit.dimension.reset();
+
+        plan = next;
+    }
+
+    /** As AetherEngine::updateTier(). */
+    void updateTier()
+    {
+        if (pendingTier == tierIndex || highBandGain.getCurrent() != highBandGain.getTarget())
+            return;
+
+        if (highBandGain.getCurrent() > 0.0f)
+        {
+            highBandGain.setTarget(0.0f);
+            return;
+        }
+
+        const bool ecoChanged = QualityTier::get(pendingTier).forceEco != tier.forceEco;
+        tierIndex = pendingTier;
+        tier = QualityTier::get(tierIndex);
+        controlCountdown = 0;
+
+        if (ecoChanged)
+        {
+            applyQuality();
+            filter.reset();
+            resonator.reset();
+            for (auto& unit : units) unit.dimension.reset();
+            std::fill(std::begin(foldHold), std::end(foldHold), 0.0f);
+            foldCounter = 0;
+        }
+
+        highBandGain.setTarget(1.0f);
+    }
+
+    void applyQuality()
+    {
+        const auto effectiveQuality = tier.forceEco ? EngineQuality::Eco : quality;
+        const int factor = effectiveQuality == EngineQuality::High ? 4 : 2;
+
+        // Linear phase keeps the 4x latency at 2x too, so a governor step never changes it
+        if (linearPhase)
+            oversampler.setConfiguration(factor, OversamplingFilter::LinearPhaseFIR, oversampler.getFIRLatency(4));
+        else
+            oversampler.setConfiguration(factor, OversamplingFilter::PolyphaseIIR);
+
+        oversamplingFactor = factor;
+
+        const int lowLatency = linearPhase ? (int)oversampler.getLatencySamples() : 0;
+        lowDelay.setDelay(lowLatency * numLanes);
+        latencySamples = lowLatency + (useLinearCrossover ? linearCrossover.getLatencySamples() : 0);
+
+        juce::dsp::ProcessSpec oversampledSpec = preparedSpec;
+        oversampledSpec.sampleRate = preparedSpec.sampleRate * oversamplingFactor;
+        oversampledSpec.maximumBlockSize = (juce::uint32)(tileSize * oversamplingFactor);
+
+        filter.prepare(oversampledSpec);
+        resonator.setSampleRate(oversampledSpec.sampleRate);
+        for (auto& unit : units)
+            unit.dimension.setSampleRate(oversampledSpec.sampleRate);
+
+        const double modRate = preparedSpec.sampleRate * oversamplingFactor / 4.0;
+        chaosLFO.prepare(modRate);
+        fluxFollower.prepare(modRate);
+        fluxFollower.setParams(10.0f, 300.0f);
+    }
+
+    bool isSilent(float* const* channels, int numSamples) const
+    {
+        for (int k = 0; k < numLanes; ++k)
+        {
+            if (channels[k] == nullptr) continue;
+
+            for (int i = 0; i < numSamples; ++i)
+                if (std::abs(channels[k][i]) >= silenceThreshold)
+                    return false;
+        }
+
+        return true;
+    }
+
+    void clear(float* const* channels, int numSamples) const
+    {
+        for (int k = 0; k < numLanes; ++k)
+            if (channels[k] != nullptr)
+                juce::FloatVectorOperations::clear(channels[k], numSamples);
+    }
+
+    // ==========================================================================
+    // HOT: state the per-sample loops touch, one slot per lane.
+    // ==========================================================================
+
+    alignas(64) float dcX1[maxLanes] {}, dcY1[maxLanes] {};
+    float foldHold[maxLanes] {};
+    float foldCounter = 0;
+    int controlCountdown = 0;
+
+    int numLanes = 2;
+    int oversamplingFactor = 4;
+    StagePlan plan;
+    QualityTier tier;
+    bool sleeping = false;
+
+    AetherLaneFilter<float> filter;
+    AetherLaneCrossover<float> crossover;
+    AetherSubProcessor<float> subProcessor;
+
+    AetherLFO chaosLFO;
+    AetherEnvelopeFollower fluxFollower;
+
+    // ==========================================================================
+    // COLD: block-rate bookkeeping, prepare-time objects and scratch buffers.
+    // ==========================================================================
+
+    alignas(64) EngineQuality quality = EngineQuality::High;
+    bool linearPhase = false;
+    bool useLinearCrossover = false;
+    int latencySamples = 0;
+
+    int tierIndex = 0;
+    int pendingTier = 0;
+    ParameterRamp highBandGain;
+    juce::dsp::ProcessSpec preparedSpec { 44100.0, 512, 2 };
+
+    const kernels::KernelTable& simd = kernels::get();
+
+    EngineRamps ramps;
+    ParameterRamp wakeFade;
+    juce::int64 silentSamples = 0;
+
+    HealthMonitor* health = nullptr;
+    int healthGroup = 0;
+    StageProfiler* profiler = nullptr;
+    int profileGroup = 0;
+
+    // Noise, gate and width per unit; their delay lines and tables live on the heap
+    std::vector<UnitState> units;
+    const juce::AudioBuffer<float>* customNoise = nullptr;
+
+    // Tile scratch, interleaved frames: the tile itself, the split bands, and the
+    // per-value drive and tilt; flux and chaos are one value per frame
+    std::vector<float> frameTile, lowTile, highTile;
+    std::vector<float> fluxTile, chaosTile, driveTile, tiltTile;
+    juce::AudioBuffer<float> splitLow, splitHigh; // Planar, for the FFT crossover
+
+    AetherLaneResonator<float> resonator;
+    AetherOversampler<float> oversampler;
+    DelayCompensation<float> lowDelay;
+    AetherLinearPhaseCrossover linearCrossover;
+};
+
+} // namespace aether
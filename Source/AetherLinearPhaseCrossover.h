@@ -0,0 +1,338 @@
+/*
+  ==============================================================================
+
+    AetherLinearPhaseCrossover.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Linear-phase band split for the sub/high crossover.
+
+    The low band is a zero-phase FIR with the Linkwitz-Riley magnitude
+    1 / (1 + (f / fc)^4), run by uniformly partitioned overlap-save FFT
+    convolution. The high band is the delayed input minus the low band, so
+    only one convolution runs per channel and the bands always sum back to
+    the input exactly. Latency: half the kernel plus one partition.
+
+    juce::dsp::FFT is float only, so unlike AetherCrossover this class is
+    not templated.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherCommon.h"
+#include "AetherDelayCompensation.h"
+#include <juce_dsp/juce_dsp.h>
+#include <memory>
+#include <vector>
+
+namespace aether
+{
+
+class AetherLinearPhaseCrossover
+{
+public:
+    static constexpr int maxChannels = 8;
+
+    // Partition (and output block) size: sets the FFT size and half the latency budget
+    static constexpr int blockOrder = 7;
+    static constexpr int blockSize = 1 << blockOrder;
+    static constexpr int numBins = blockSize + 1;
+
+    /**
+     * Message thread. Allocates everything for numChannels channels; the kernel
+     * length follows the sample rate. A stereo engine prepares both slots even
+     * while it runs dual mono: that can end at any block.
+     */
+    void prepare(double newSampleRate, int numChannels = 2)
+    {
+        jassert(numChannels >= 1 && numChannels <= maxChannels);
+        sampleRate = newSampleRate;
+        numPrepared = numChannels;
+
+        // ~30 ms of kernel: the 60 Hz low end has decayed well below the window by then
+        kernelOrder = juce::jmax(blockOrder + 1, (int)std::ceil(std::log2(0.03 * sampleRate)));
+        kernelSize = 1 << kernelOrder;
+        numPartitions = kernelSize / blockSize;
+
+        blockFFT = std::make_unique<juce::dsp::FFT>(blockOrder + 1);
+        designFFT = std::make_unique<juce::dsp::FFT>(kernelOrder);
+
+        designBuffer.assign((size_t)kernelSize * 2, 0.0f);
+        fftBuffer.assign((size_t)blockSize * 4, 0.0f);
+        taps.assign((size_t)kernelSize, 0.0f);
+
+        for (auto& k : kernels)
+        {
+            k.re.assign((size_t)(numPartitions * numBins), 0.0f);
+            k.im.assign((size_t)(numPartitions * numBins), 0.0f);
+            k.cutoff = 0.0f;
+        }
+
+        accRe.assign((size_t)numBins, 0.0f);
+        accIm.assign((size_t)numBins, 0.0f);
+        faded.assign((size_t)blockSize, 0.0f);
+
+        for (int ch = 0; ch < maxChannels; ++ch)
+        {
+            auto& c = channels[(size_t)ch];
+            const size_t used = ch < numPrepared ? 1 : 0;
+            c.input.assign(used * (size_t)blockSize * 2, 0.0f);
+            c.output.assign(used * (size_t)blockSize, 0.0f);
+            c.spectraRe.assign(used * (size_t)(numPartitions * numBins), 0.0f);
+            c.spectraIm.assign(used * (size_t)(numPartitions * numBins), 0.0f);
+        }
+
+        latency = (kernelSize - 2) / 2 + blockSize;
+        highDelay.prepare(numPrepared, latency);
+        highDelay.setDelay(latency);
+
+        design(targetCutoff, kernels[0]);
+        active = 0;
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& c : channels)
+        {
+            std::fill(c.input.begin(), c.input.end(), 0.0f);
+            std::fill(c.output.begin(), c.output.end(), 0.0f);
+            std::fill(c.spectraRe.begin(), c.spectraRe.end(), 0.0f);
+            std::fill(c.spectraIm.begin(), c.spectraIm.end(), 0.0f);
+        }
+
+        highDelay.reset();
+        position = 0;
+        newest = 0;
+    }
+
+    /** Block rate. A new cutoff is designed at the next partition and crossfaded in over one partition. */
+    void setCutoff(float newCutoff) { targetCutoff = newCutoff; }
+
+    int getLatencySamples() const { return latency; }
+
+    /**
+     * Splits the first numChannels prepared channels. high may alias in; low must not.
+     * Channels beyond numChannels are left untouched (see copyChannel()).
+     */
+    void process(const float* const* in, float* const* low, float* const* high, int numChannels, int numSamples)
+    {
+        jassert(numChannels <= numPrepared);
+
+        for (int done = 0; done < numSamples;)
+        {
+            const int n = juce::jmin(numSamples - done, blockSize - position);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                auto& c = channels[(size_t)ch];
+                std::copy(in[ch] + done, in[ch] + done + n, c.input.begin() + blockSize + position);
+                std::copy(c.output.begin() + position, c.output.begin() + position + n, low[ch] + done);
+            }
+
+            done += n;
+            position += n;
+
+            if (position == blockSize)
+            {
+                runPartition(numChannels);
+                position = 0;
+            }
+        }
+
+        // High = input, delayed to line up with the low band, minus the low band
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            if (high[ch] != in[ch])
+                std::copy(in[ch], in[ch] + numSamples, high[ch]);
+
+            highDelay.process(high[ch], ch, numSamples);
+            juce::FloatVectorOperations::subtract(high[ch], low[ch], numSamples);
+        }
+    }
+
+    /** Makes channel `to` continue exactly like `from` (dual mono ending). No allocation. */
+    void copyChannel(int from, int to)
+    {
+        channels[(size_t)to] = channels[(size_t)from];
+        highDelay.copyChannel(from, to);
+    }
+
+private:
+    struct Kernel
+    {
+        std::vector<float> re, im; // numPartitions x numBins, split complex
+        float cutoff = 0.0f;
+    };
+
+    struct Channel
+    {
+        std::vector<float> input;                // Previous partition + the one being filled
+        std::vector<float> output;               // Low band for the partition being filled
+        std::vector<float> spectraRe, spectraIm; // Frequency-domain delay line, numPartitions deep
+    };
+
+    /** One partition: FFT the newest input, multiply-accumulate against the kernel, IFFT. */
+    void runPartition(int numChannels)
+    {
+        const bool fading = kernels[(size_t)active].cutoff != targetCutoff;
+        if (fading)
+            design(targetCutoff, kernels[(size_t)(1 - active)]);
+
+        newest = newest == 0 ? numPartitions - 1 : newest - 1;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& c = channels[(size_t)ch];
+
+            // Forward transform of the last two partitions (overlap-save)
+            std::copy(c.input.begin(), c.input.end(), fftBuffer.begin());
+            blockFFT->performRealOnlyForwardTransform(fftBuffer.data(), true);
+
+            float* xr = c.spectraRe.data() + newest * numBins;
+            float* xi = c.spectraIm.data() + newest * numBins;
+            for (int k = 0; k < numBins; ++k)
+            {
+                xr[k] = fftBuffer[(size_t)(2 * k)];
+                xi[k] = fftBuffer[(size_t)(2 * k + 1)];
+            }
+
+            convolve(c, kernels[(size_t)active], c.output.data());
+
+            if (fading)
+            {
+                // Linear crossfade; the high band is derived from the low band, so it follows
+                convolve(c, kernels[(size_t)(1 - active)], faded.data());
+
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    const float w = (float)(i + 1) / (float)blockSize;
+                    c.output[(size_t)i] += w * (faded[(size_t)i] - c.output[(size_t)i]);
+                }
+            }
+
+            // Slide: the partition just filled becomes the previous one
+            std::copy(c.input.begin() + blockSize, c.input.end(), c.input.begin());
+        }
+
+        if (fading)
+            active = 1 - active;
+    }
+
+    void convolve(const Channel& c, const Kernel& kernel, float* out)
+    {
+        std::fill(accRe.begin(), accRe.end(), 0.0f);
+        std::fill(accIm.begin(), accIm.end(), 0.0f);
+
+        float* yr = accRe.data();
+        float* yi = accIm.data();
+
+        // Partition p of the kernel meets the input spectrum from p partitions ago
+        for (int p = 0; p < numPartitions; ++p)
+        {
+            const int slot = (newest + p) % numPartitions;
+            const float* xr = c.spectraRe.data() + slot * numBins;
+            const float* xi = c.spectraIm.data() + slot * numBins;
+            const float* hr = kernel.re.data() + p * numBins;
+            const float* hi = kernel.im.data() + p * numBins;
+
+            for (int k = 0; k < numBins; ++k)
+            {
+                yr[k] += xr[k] * hr[k] - xi[k] * hi[k];
+                yi[k] += xr[k] * hi[k] + xi[k] * hr[k];
+            }
+        }
+
+        // Full conjugate-symmetric spectrum, then back to time; the second half is the valid part
+        const int fftSize = blockSize * 2;
+        for (int k = 0; k < numBins; ++k)
+        {
+            fftBuffer[(size_t)(2 * k)] = yr[k];
+            fftBuffer[(size_t)(2 * k + 1)] = yi[k];
+        }
+        for (int k = numBins; k < fftSize; ++k)
+        {
+            fftBuffer[(size_t)(2 * k)] = yr[fftSize - k];
+            fftBuffer[(size_t)(2 * k + 1)] = -yi[fftSize - k];
+        }
+
+        blockFFT->performRealOnlyInverseTransform(fftBuffer.data());
+        std::copy(fftBuffer.begin() + blockSize, fftBuffer.begin() + fftSize, out);
+    }
+
+    /**
+     * Frequency-sampled zero-phase lowpass, centred and Hann-windowed to
+     * kernelSize - 1 taps, then cut into partitions and transformed.
+     * Runs on the audio thread when the cutoff moves: no allocation.
+     */
+    void design(float cutoff, Kernel& kernel)
+    {
+        const int N = kernelSize;
+        const double fc = juce::jlimit(10.0, sampleRate * 0.45, (double)cutoff);
+
+        for (int k = 0; k < N; ++k)
+        {
+            const double f = juce::jmin(k, N - k) * sampleRate / N;
+            const double ratio = f / fc;
+            designBuffer[(size_t)(2 * k)] = (float)(1.0 / (1.0 + ratio * ratio * ratio * ratio));
+            designBuffer[(size_t)(2 * k + 1)] = 0.0f;
+        }
+
+        designFFT->performRealOnlyInverseTransform(designBuffer.data());
+
+        // Circular zero-phase response -> causal taps centred on N/2 - 1
+        const int centre = N / 2 - 1;
+        double sum = 0.0;
+        for (int n = 0; n < N - 1; ++n)
+        {
+            const int lag = n - centre;
+            const double window = 0.5 - 0.5 * std::cos(juce::MathConstants<double>::twoPi * (n + 1) / N);
+            taps[(size_t)n] = (float)(designBuffer[(size_t)((lag + N) % N)] * window);
+            sum += taps[(size_t)n];
+        }
+        taps[(size_t)(N - 1)] = 0.0f;
+
+        // Exact unity gain at DC
+        for (int n = 0; n < N - 1; ++n)
+            taps[(size_t)n] = (float)(taps[(size_t)n] / sum);
+
+        for (int p = 0; p < numPartitions; ++p)
+        {
+            std::fill(fftBuffer.begin(), fftBuffer.end(), 0.0f);
+            std::copy(taps.begin() + p * blockSize, taps.begin() + (p + 1) * blockSize, fftBuffer.begin());
+            blockFFT->performRealOnlyForwardTransform(fftBuffer.data(), true);
+
+            for (int k = 0; k < numBins; ++k)
+            {
+                kernel.re[(size_t)(p * numBins + k)] = fftBuffer[(size_t)(2 * k)];
+                kernel.im[(size_t)(p * numBins + k)] = fftBuffer[(size_t)(2 * k + 1)];
+            }
+        }
+
+        kernel.cutoff = cutoff;
+    }
+
+    double sampleRate = 44100.0;
+    int kernelOrder = 11;
+    int kernelSize = 2048;
+    int numPartitions = 16;
+    int latency = 0;
+
+    std::unique_ptr<juce::dsp::FFT> blockFFT, designFFT;
+    std::vector<float> designBuffer, fftBuffer, taps, accRe, accIm, faded;
+
+    Kernel kernels[2];
+    int active = 0;
+    float targetCutoff = 150.0f;
+
+    Channel channels[maxChannels];
+    int numPrepared = 2;
+    DelayCompensation<float> highDelay;
+    int position = 0; // Samples into the partition being filled
+    int newest = 0;   // Spectrum slot of the latest partition
+};
+
+} // namespace aether
@@ -29,6 +29,15 @@ public:
         currentBPM = bpm;
     }
 
+    /** Restarts from phase 0 with a fixed random sequence (Random and Drift), for repeatable renders. */
+    void setSeed(juce::int64 seed)
+    {
+        random.setSeed(seed);
+        phase = 0.0f;
+        targetRandom = 0.0f;
+        currentDrift = 0.0f;
+    }
+
     float getNextSample()
     {
         float actualFreq = frequency;
@@ -69,13 +78,13 @@ public:
             case Waveform::Random:
                 // S&H
                 if (phase < actualFreq / sampleRate) 
-                    targetRandom = ((float)std::rand() / (float)RAND_MAX) * 2.0f - 1.0f;
+                    targetRandom = random.nextFloat() * 2.0f - 1.0f;
                 output = targetRandom;
                 break;
             case Waveform::Drift:
                 // Smooth Random Walk
                 if (phase < actualFreq / sampleRate) 
-                    targetRandom = ((float)std::rand() / (float)RAND_MAX) * 2.0f - 1.0f;
+                    targetRandom = random.nextFloat() * 2.0f - 1.0f;
                 
                 // Slew towards target
                 currentDrift += (targetRandom - currentDrift) * 0.001f; // Slow slew
@@ -94,6 +103,7 @@ private:
     double currentBPM = 120.0;
     bool isSynced = false;
     Waveform currentWave = Waveform::Sine;
+    juce::Random random; // Per instance: std::rand() is shared and cannot be seeded per LFO
 };
 
 /**
@@ -121,6 +131,8 @@ public:
         return envelope;
     }
 
+    void reset() { envelope = 0.0f; }
+
 private:
     float sampleRate = 44100.0f;
     float envelope = 0.0f;
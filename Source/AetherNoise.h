@@ -10,9 +10,10 @@
     Supports White, Pink, and Crackle types with stereo spreading.
     
     Thread-Safe Custom Noise Loading:
-    Uses a Double-Buffer/Swap mechanism with a CriticalSection to safely
-    exchange buffers between the UI thread (Loader) and Audio Thread (Reader).
-    The Audio Thread uses a TryLock to prevent blocking/priority inversion.
+    The UI thread allocates the new buffer and hands it over through the
+    engine command queue. The swap itself happens on the audio thread with
+    no lock, and the previous buffer is handed back to be freed on the UI side.
+    AetherBusEngine owns the buffer; the generator only reads it.
 
   ==============================================================================
 */
@@ -48,23 +49,30 @@ public:
         hpL_x1 = 0; hpL_y1 = 0; hpR_x1 = 0; hpR_y1 = 0;
         hpL_x2 = 0; hpL_y2 = 0; hpR_x2 = 0; hpR_y2 = 0;
         
-        // Reset Custom Position (Thread Safe)
-        const juce::ScopedLock sl(lock);
         customPos = 0;
     }
     
-    void setCustomSample(const juce::AudioBuffer<float>& newSample)
+    /**
+     * Audio thread only. Plays newSample from its start (nullptr: silence).
+     * Not owned: the caller keeps it alive until it is replaced.
+     */
+    void setCustomSample(const juce::AudioBuffer<float>* newSample)
     {
-        // Allocate and copy on UI thread (or caller thread)
-        auto newBuf = std::make_unique<juce::AudioBuffer<float>>();
-        newBuf->makeCopyOf(newSample);
-        
-        // Swap Pointer Safely
-        const juce::ScopedLock sl(lock);
-        customBuffer = std::move(newBuf);
+        customBuffer = newSample;
         customPos = 0;
     }
 
+    /** Fixes the White / Pink / Crackle sequence, for repeatable renders. */
+    void setSeed(juce::int64 seed) { random.setSeed(seed); }
+
+    /** Times the high-pass state was cleared after going non-finite, since the last call. Audio thread. */
+    int takeRecoveries()
+    {
+        const int n = recoveries;
+        recoveries = 0;
+        return n;
+    }
+
     void process(SampleType& left, SampleType& right, float volume, float distortion, NoiseType type, float envelope)
     {
         // 1. GATED NOISE
@@ -117,12 +125,8 @@ public:
                 
             case NoiseType::Custom:
             {
-                // REAL-TIME SAFETY: Use TryLock
-                // If the UI is currently swapping the buffer (milliseconds),
-                // we simply skip one sample rather than blocking the audio thread.
-                const juce::ScopedTryLock sl(lock);
-                
-                if (sl.isLocked() && customBuffer && customBuffer->getNumSamples() > 0)
+                // The buffer is only ever swapped on this thread, no lock needed
+                if (customBuffer && customBuffer->getNumSamples() > 0)
                 {
                     nL = customBuffer->getSample(0, customPos);
                     // Use Right channel if available, else duplicate Left
@@ -134,7 +138,7 @@ public:
                     customPos++;
                     if (customPos >= customBuffer->getNumSamples()) customPos = 0;
                 }
-                // If lock failed or buffer empty, nL/nR remain 0 (Silence)
+                // If no buffer is loaded, nL/nR remain 0 (Silence)
             }
             break;
         }
@@ -167,9 +171,11 @@ public:
         // NAN CHECK
         if (!std::isfinite(hpL_y1) || !std::isfinite(hpL_y2) || !std::isfinite(nL)) {
             hpL_x1 = 0; hpL_y1 = 0; hpL_x2 = 0; hpL_y2 = 0; nL = 0;
+            ++recoveries;
         }
         if (!std::isfinite(hpR_y1) || !std::isfinite(hpR_y2) || !std::isfinite(nR)) {
             hpR_x1 = 0; hpR_y1 = 0; hpR_x2 = 0; hpR_y2 = 0; nR = 0;
+            ++recoveries;
         }
 
         // Inject into signal
@@ -186,10 +192,11 @@ private:
     float hpL_x1, hpL_y1, hpR_x1, hpR_y1;
     float hpL_x2, hpL_y2, hpR_x2, hpR_y2;
     
-    // Custom Sample (Thread Safe)
-    juce::CriticalSection lock;
-    std::unique_ptr<juce::AudioBuffer<float>> customBuffer;
+    // Custom Sample (set by the audio thread, owned by the caller)
+    const juce::AudioBuffer<float>* customBuffer = nullptr;
     int customPos = 0;
+
+    int recoveries = 0; // Guard trips since takeRecoveries()
 };
 
 } // namespace aether
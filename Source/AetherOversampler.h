@@ -0,0 +1,885 @@
+/*
+  ==============================================================================
+
+    AetherOversampler.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Polyphase halfband up/down sampler for the high band (2x, 4x or 8x).
+
+    Each 2x stage is a halfband filter split into its two polyphase branches,
+    so every filter runs at the lower of its two rates. Both stereo lanes are
+    processed together: the IIR stages run L/R of both branches as one
+    4-lane vector, the FIR stages convolve interleaved L/R frames. A mono
+    oversampler runs the left lane alone, sample for sample the same.
+
+    Interleaved, up to eight channels go through as frames of lanes (one
+    per channel), every lane of both branches in one vector: a whole bus
+    costs one pass. Two interleaved lanes match the stereo path exactly.
+
+    - PolyphaseIIR: two allpass chains per stage (minimum phase, cheapest).
+    - LinearPhaseFIR: Kaiser-windowed halfband per stage. Latency is padded
+      to a whole number of host samples, so it can be reported and matched
+      exactly.
+
+    Every configuration is designed and allocated in prepare(); switching
+    factor or filter on the audio thread only resets state.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherCommon.h"
+#include <vector>
+#include <cstring>
+#include <type_traits>
+
+namespace aether
+{
+
+enum class OversamplingFilter
+{
+    PolyphaseIIR,  // Minimum phase, fractional latency
+    LinearPhaseFIR // Linear phase, whole-sample latency
+};
+
+template <typename SampleType>
+class AetherOversampler
+{
+public:
+    static constexpr int maxStages = 3; // 8x
+    static constexpr int maxLanes = 8;
+
+    /**
+     * Message thread. Designs every stage and sizes the buffers for up to
+     * maxSamples per call (1x): one channel or a stereo pair in planar
+     * buffers (processUp / processDown), or 2 to maxLanes interleaved
+     * channels (processUpLanes / processDownLanes).
+     */
+    void prepare(int maxSamples, int channels = 2, bool interleavedLanes = false)
+    {
+        jassert(interleavedLanes ? channels >= 2 && channels <= maxLanes : channels == 1 || channels == 2);
+        maxBaseSamples = juce::jmax(1, maxSamples);
+        numChannels = channels;
+        interleaved = interleavedLanes;
+
+        // Mono keeps the stereo lane layout and runs its left lanes
+        const int lanes = juce::jmax(2, channels);
+
+        for (int s = 0; s < maxStages; ++s)
+        {
+            // The first stage carries the audio band right up to the transition;
+            // later stages only see content below a quarter of their input rate.
+            iir[s].design(iirSpecs[s].numCoefs, iirSpecs[s].transition, lanes);
+            fir[s].design(firHalfLengths[s], maxBaseSamples << s, lanes);
+        }
+
+        // Values per frame in the top-rate buffers: planar channels each have their own
+        const int frame = interleaved ? channels : 1;
+
+        // FIR alignment delay at the top rate: up to the 8x latency at 2x, plus rounding
+        for (auto& line : padLine)
+            line.assign((size_t)(((getMaxLatencySamples() + 1) << maxStages) * frame), 0);
+
+        const int maxTop = maxBaseSamples << maxStages;
+        upBuffer[0].assign((size_t)(maxTop * frame), 0);
+        upBuffer[1].assign(interleaved ? 0 : (size_t)maxTop, 0);
+        discard.assign((size_t)maxBaseSamples, 0);
+
+        // Ping-pong between stages: interleaved channels at up to half the top rate
+        scratch[0].assign((size_t)(maxTop * lanes / 2), 0);
+        scratch[1].assign((size_t)(maxTop * lanes / 2), 0);
+
+        setConfiguration(factor, filter);
+    }
+
+    /**
+     * Audio thread, no allocation. factor is 2, 4 or 8. Resets the filter state.
+     * LinearPhaseFIR is delayed to at least minLatency host samples, so callers
+     * can keep one reported latency across factors.
+     */
+    void setConfiguration(int newFactor, OversamplingFilter newFilter, int minLatency = 0)
+    {
+        jassert(newFactor == 2 || newFactor == 4 || newFactor == 8);
+
+        factor = newFactor;
+        filter = newFilter;
+        numStages = newFactor == 8 ? 3 : newFactor == 4 ? 2 : 1;
+
+        topPad = 0;
+        latency = 0.0;
+
+        if (filter == OversamplingFilter::LinearPhaseFIR)
+        {
+            const int firLatency = juce::jlimit(getFIRLatency(factor), getMaxLatencySamples(), minLatency);
+            topPad = firLatency * factor - getTopDelay(numStages);
+            latency = (double)firLatency;
+        }
+        else
+        {
+            for (int s = 0; s < numStages; ++s)
+                latency += iir[s].getRoundTrip() / (double)(1 << s);
+        }
+
+        reset();
+    }
+
+    void reset()
+    {
+        for (int s = 0; s < maxStages; ++s)
+        {
+            iir[s].reset();
+            fir[s].reset();
+        }
+
+        for (auto& line : padLine)
+            std::fill(line.begin(), line.end(), (SampleType)0);
+        padIndex = 0;
+    }
+
+    int getFactor() const { return factor; }
+    OversamplingFilter getFilter() const { return filter; }
+
+    /** Round-trip delay in host samples. A whole number for LinearPhaseFIR; DC group delay for PolyphaseIIR. */
+    double getLatencySamples() const { return latency; }
+
+    /** Whole-sample latency of LinearPhaseFIR at a factor, before any minLatency padding. */
+    int getFIRLatency(int atFactor) const
+    {
+        const int stages = atFactor == 8 ? 3 : atFactor == 4 ? 2 : 1;
+        return (getTopDelay(stages) + atFactor - 1) / atFactor;
+    }
+
+    /** Worst-case latency over every configuration (for sizing compensation delays). */
+    int getMaxLatencySamples() const { return getFIRLatency(1 << maxStages); }
+
+    /**
+     * Upsamples numSamples samples into the internal planar buffers,
+     * getUpChannel(0/1), numSamples * factor long. A mono oversampler ignores
+     * inR (which may be nullptr) and only fills channel 0.
+     */
+    void processUp(const SampleType* inL, const SampleType* inR, int numSamples)
+    {
+        jassert(numSamples <= maxBaseSamples);
+
+        Port in { const_cast<SampleType*>(inL), const_cast<SampleType*>(inR), 1 };
+        int n = numSamples;
+
+        for (int s = 0; s < numStages; ++s)
+        {
+            const bool last = s == numStages - 1;
+            Port out = last ? Port { upBuffer[0].data(), upBuffer[1].data(), 1 } : scratchPort(s);
+
+            if (filter == OversamplingFilter::LinearPhaseFIR)
+                runStage(fir[s], in, out, n, true);
+            else
+                runStage(iir[s], in, out, n, true);
+
+            in = out;
+            n *= 2;
+        }
+    }
+
+    SampleType* getUpChannel(int channel) { return upBuffer[(size_t)(channel > 0)].data(); }
+
+    /**
+     * Interleaved: upsamples numSamples frames of Lanes channels (Lanes is
+     * the prepared channel count) into getUpLanes(), numSamples * factor
+     * frames long.
+     */
+    template <int Lanes>
+    void processUpLanes(const SampleType* in, int numSamples)
+    {
+        jassert(interleaved && Lanes == numChannels && numSamples <= maxBaseSamples);
+
+        const SampleType* src = in;
+        int n = numSamples;
+
+        for (int s = 0; s < numStages; ++s)
+        {
+            SampleType* dst = s == numStages - 1 ? upBuffer[0].data() : scratch[s & 1].data();
+
+            if (filter == OversamplingFilter::LinearPhaseFIR)
+                fir[s].template upLanes<Lanes>(src, dst, n);
+            else
+                iir[s].template upLanes<Lanes>(src, dst, n);
+
+            src = dst;
+            n *= 2;
+        }
+    }
+
+    SampleType* getUpLanes() { return upBuffer[0].data(); }
+
+    /** Interleaved: downsamples getUpLanes() back to numSamples frames in out (may be the processUpLanes() input). */
+    template <int Lanes>
+    void processDownLanes(SampleType* out, int numSamples)
+    {
+        jassert(interleaved && Lanes == numChannels && numSamples <= maxBaseSamples);
+
+        int n = numSamples * factor;
+        const SampleType* src = upBuffer[0].data();
+
+        if (topPad > 0)
+            applyPad(n);
+
+        for (int s = numStages - 1; s >= 0; --s)
+        {
+            n /= 2;
+            SampleType* dst = s == 0 ? out : scratch[s & 1].data();
+
+            if (filter == OversamplingFilter::LinearPhaseFIR)
+                fir[s].template downLanes<Lanes>(src, dst, n);
+            else
+                iir[s].template downLanes<Lanes>(src, dst, n);
+
+            src = dst;
+        }
+    }
+
+    /**
+     * Downsamples the (processed) internal buffers back to numSamples at the
+     * host rate. outL/outR may be the processUp() input (in-place on the tile);
+     * outR may be nullptr, and is never written by a mono oversampler.
+     */
+    void processDown(SampleType* outL, SampleType* outR, int numSamples)
+    {
+        jassert(numSamples <= maxBaseSamples);
+
+        int n = numSamples * factor;
+        Port in { upBuffer[0].data(), upBuffer[1].data(), 1 };
+
+        if (topPad > 0)
+            applyPad(n);
+
+        for (int s = numStages - 1; s >= 0; --s)
+        {
+            n /= 2;
+            Port out = s == 0 ? Port { outL, outR != nullptr ? outR : discard.data(), 1 } : scratchPort(s);
+
+            if (filter == OversamplingFilter::LinearPhaseFIR)
+                runStage(fir[s], in, out, n, false);
+            else
+                runStage(iir[s], in, out, n, false);
+
+            in = out;
+        }
+    }
+
+private:
+    /** Stereo sample access: planar (stride 1, separate pointers) or interleaved (stride 2). */
+    struct Port
+    {
+        SampleType* l;
+        SampleType* r;
+        int stride;
+    };
+
+    /** Ping-pong buffer between stages: interleaved stereo, or plain mono. */
+    Port scratchPort(int stage)
+    {
+        SampleType* data = scratch[stage & 1].data();
+        return numChannels == 2 ? Port { data, data + 1, 2 } : Port { data, nullptr, 1 };
+    }
+
+    /** One stage, with the channel count fixed for its inner loops. */
+    template <typename Stage>
+    void runStage(Stage& stage, Port in, Port out, int numSamples, bool up)
+    {
+        if (numChannels == 2)
+        {
+            if (up) stage.template up<2>(in, out, numSamples);
+            else stage.template down<2>(in, out, numSamples);
+        }
+        else
+        {
+            if (up) stage.template up<1>(in, out, numSamples);
+            else stage.template down<1>(in, out, numSamples);
+        }
+    }
+
+    //==============================================================================
+    /**
+     * Two chains of first-order allpasses (c + z^-1) / (1 + c z^-1) at the low
+     * rate; even coefficients on branch 0, odd ones on branch 1. Lanes are
+     * every channel of branch 0, then every channel of branch 1: { L0, R0,
+     * L1, R1 } for stereo. Mono runs { L0, L1 } of the stereo layout.
+     */
+    struct IIRStage
+    {
+        static constexpr int maxPairs = 4;
+        static constexpr int width = 2 * maxLanes; // Both branches of every channel
+
+        void design(int numCoefs, double transition, int channels)
+        {
+            jassert(numCoefs % 2 == 0 && numCoefs / 2 <= maxPairs);
+            numPairs = numCoefs / 2;
+
+            double c[maxPairs * 2] {};
+            computeCoefficients(c, numCoefs, transition);
+
+            // DC group delay of each branch, in low-rate samples
+            double delay0 = 0, delay1 = 0;
+            for (int j = 0; j < numPairs; ++j)
+            {
+                delay0 += (1.0 - c[2 * j]) / (1.0 + c[2 * j]);
+                delay1 += (1.0 - c[2 * j + 1]) / (1.0 + c[2 * j + 1]);
+
+                for (int k = 0; k < 2 * channels; ++k)
+                    coef[j][k] = (SampleType)c[2 * j + k / channels];
+            }
+
+            // Halfband at the high rate: the branches interleave, branch 1 one sample later.
+            // Upsampling delays by that, downsampling by (that - 1) / 2 low-rate samples.
+            const double highDelay = (2.0 * delay0 + 1.0 + 2.0 * delay1) * 0.5;
+            roundTrip = highDelay - 0.5;
+        }
+
+        void reset()
+        {
+            std::memset(upX, 0, sizeof(upX));
+            std::memset(upY, 0, sizeof(upY));
+            std::memset(downX, 0, sizeof(downX));
+            std::memset(downY, 0, sizeof(downY));
+        }
+
+        /** Low-rate samples, up and down combined. */
+        double getRoundTrip() const { return roundTrip; }
+
+        template <int Channels>
+        void up(Port in, Port out, int numSamples)
+        {
+            if constexpr (Channels == 1)
+            {
+                forPairs([&](auto pairs) { upMono<decltype(pairs)::value>(in, out, numSamples); });
+            }
+            else
+            {
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    const SampleType l = in.l[i * in.stride];
+                    const SampleType r = in.r[i * in.stride];
+                    SampleType v[4] = { l, r, l, r };
+
+                    run(v, upX, upY);
+
+                    const int o = 2 * i * out.stride;
+                    out.l[o] = v[0];
+                    out.r[o] = v[1];
+                    out.l[o + out.stride] = v[2];
+                    out.r[o + out.stride] = v[3];
+                }
+            }
+        }
+
+        template <int Channels>
+        void down(Port in, Port out, int numSamples)
+        {
+            if constexpr (Channels == 1)
+            {
+                forPairs([&](auto pairs) { downMono<decltype(pairs)::value>(in, out, numSamples); });
+            }
+            else
+            {
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    const int e = 2 * i * in.stride;
+                    const int o = e + in.stride;
+                    SampleType v[4] = { in.l[o], in.r[o], in.l[e], in.r[e] };
+
+                    run(v, downX, downY);
+
+                    out.l[i * out.stride] = (SampleType)0.5 * (v[0] + v[2]);
+                    out.r[i * out.stride] = (SampleType)0.5 * (v[1] + v[3]);
+                }
+            }
+        }
+
+        /** Interleaved frames of Lanes channels: branch 0 takes frame 2i, branch 1 frame 2i + 1. */
+        template <int Lanes>
+        void upLanes(const SampleType* in, SampleType* out, int numSamples)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                SampleType v[2 * Lanes];
+                for (int k = 0; k < Lanes; ++k)
+                    v[k] = v[Lanes + k] = in[Lanes * i + k];
+
+                run(v, upX, upY);
+
+                for (int k = 0; k < 2 * Lanes; ++k)
+                    out[2 * Lanes * i + k] = v[k];
+            }
+        }
+
+        template <int Lanes>
+        void downLanes(const SampleType* in, SampleType* out, int numSamples)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const SampleType* even = in + 2 * Lanes * i;
+                SampleType v[2 * Lanes];
+                for (int k = 0; k < Lanes; ++k)
+                {
+                    v[k] = even[Lanes + k];
+                    v[Lanes + k] = even[k];
+                }
+
+                run(v, downX, downY);
+
+                for (int k = 0; k < Lanes; ++k)
+                    out[Lanes * i + k] = (SampleType)0.5 * (v[k] + v[Lanes + k]);
+            }
+        }
+
+        /** The allpass chains over the first N lanes. */
+        template <int N>
+        void run(SampleType (&v)[N], SampleType (&x)[maxPairs][width], SampleType (&y)[maxPairs][width])
+        {
+            for (int j = 0; j < numPairs; ++j)
+            {
+                for (int k = 0; k < N; ++k)
+                {
+                    const SampleType t = (v[k] - y[j][k]) * coef[j][k] + x[j][k];
+                    x[j][k] = v[k];
+                    y[j][k] = t;
+                    v[k] = t;
+                }
+            }
+        }
+
+        //==============================================================================
+        // Mono: lanes { L0, L1 } only. They are packed into a local copy of the
+        // state for the block, with the pair count fixed at compile time, so the
+        // whole chain stays in registers; the right lanes are left untouched.
+
+        /** Calls fn with the pair count as a compile-time constant. */
+        template <typename Fn>
+        void forPairs(Fn&& fn)
+        {
+            switch (numPairs)
+            {
+                case 1:  fn(std::integral_constant<int, 1>()); break;
+                case 2:  fn(std::integral_constant<int, 2>()); break;
+                case 3:  fn(std::integral_constant<int, 3>()); break;
+                default: fn(std::integral_constant<int, 4>()); break;
+            }
+        }
+
+        template <int Pairs>
+        struct MonoChain
+        {
+            MonoChain(const SampleType (&coefs)[maxPairs][width], const SampleType (&x)[maxPairs][width], const SampleType (&y)[maxPairs][width])
+            {
+                for (int j = 0; j < Pairs; ++j)
+                    for (int k = 0; k < 2; ++k)
+                    {
+                        c[j][k] = coefs[j][2 * k];
+                        sx[j][k] = x[j][2 * k];
+                        sy[j][k] = y[j][2 * k];
+                    }
+            }
+
+            void store(SampleType (&x)[maxPairs][width], SampleType (&y)[maxPairs][width]) const
+            {
+                for (int j = 0; j < Pairs; ++j)
+                    for (int k = 0; k < 2; ++k)
+                    {
+                        x[j][2 * k] = sx[j][k];
+                        y[j][2 * k] = sy[j][k];
+                    }
+            }
+
+            void run(SampleType (&v)[2])
+            {
+                for (int j = 0; j < Pairs; ++j)
+                {
+                    for (int k = 0; k < 2; ++k)
+                    {
+                        const SampleType t = (v[k] - sy[j][k]) * c[j][k] + sx[j][k];
+                        sx[j][k] = v[k];
+                        sy[j][k] = t;
+                        v[k] = t;
+                    }
+                }
+            }
+
+            SampleType c[Pairs][2], sx[Pairs][2], sy[Pairs][2];
+        };
+
+        template <int Pairs>
+        void upMono(Port in, Port out, int numSamples)
+        {
+            MonoChain<Pairs> chain(coef, upX, upY);
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const SampleType l = in.l[i * in.stride];
+                SampleType v[2] = { l, l };
+
+                chain.run(v);
+
+                const int o = 2 * i * out.stride;
+                out.l[o] = v[0];
+                out.l[o + out.stride] = v[1];
+            }
+
+            chain.store(upX, upY);
+        }
+
+        template <int Pairs>
+        void downMono(Port in, Port out, int numSamples)
+        {
+            MonoChain<Pairs> chain(coef, downX, downY);
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const int e = 2 * i * in.stride;
+                SampleType v[2] = { in.l[e + in.stride], in.l[e] };
+
+                chain.run(v);
+
+                out.l[i * out.stride] = (SampleType)0.5 * (v[0] + v[1]);
+            }
+
+            chain.store(downX, downY);
+        }
+
+        /**
+         * Halfband polyphase allpass design (elliptic prototype, as in
+         * Valenzuela & Constantinides): numCoefs coefficients for a transition
+         * band `transition` wide (normalised to the high rate) below fs / 4.
+         */
+        static void computeCoefficients(double* c, int numCoefs, double transition)
+        {
+            const double pi = juce::MathConstants<double>::pi;
+
+            double k = std::tan((1.0 - transition * 2.0) * pi / 4.0);
+            k *= k;
+            const double kksqrt = std::pow(1.0 - k * k, 0.25);
+            const double e = 0.5 * (1.0 - kksqrt) / (1.0 + kksqrt);
+            const double e4 = e * e * e * e;
+            const double q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+
+            const int order = numCoefs * 2 + 1;
+
+            for (int index = 0; index < numCoefs; ++index)
+            {
+                const int m = index + 1;
+
+                double num = 0.0, term = 0.0, sign = 1.0;
+                for (int i = 0; i == 0 || std::abs(term) > 1.0e-100; ++i, sign = -sign)
+                {
+                    term = std::pow(q, (double)(i * (i + 1))) * std::sin((i * 2 + 1) * m * pi / order) * sign;
+                    num += term;
+                }
+
+                double den = 0.0;
+                sign = -1.0;
+                for (int i = 1; i == 1 || std::abs(term) > 1.0e-100; ++i, sign = -sign)
+                {
+                    term = std::pow(q, (double)(i * i)) * std::cos(i * 2 * m * pi / order) * sign;
+                    den += term;
+                }
+
+                const double ww = num * std::pow(q, 0.25) / (den + 0.5);
+                const double wwsq = ww * ww;
+                const double x = std::sqrt((1.0 - wwsq * k) * (1.0 - wwsq / k)) / (1.0 + wwsq);
+                c[index] = (1.0 - x) / (1.0 + x);
+            }
+        }
+
+        int numPairs = 0;
+        double roundTrip = 0.0;
+        SampleType coef[maxPairs][width] {};
+        SampleType upX[maxPairs][width] {}, upY[maxPairs][width] {};
+        SampleType downX[maxPairs][width] {}, downY[maxPairs][width] {};
+    };
+
+    //==============================================================================
+    /**
+     * Halfband FIR of 4K - 1 taps: every other tap is zero except the centre
+     * (0.5), so one branch is 2K taps and the other a pure delay. History is
+     * kept as interleaved frames (L/R, every lane, or plain mono samples) and
+     * convolved with the output index as the inner loop, so all lanes and
+     * neighbouring frames vectorise together.
+     */
+    struct FIRStage
+    {
+        void design(int halfLength, int maxLowSamples, int channels)
+        {
+            K = halfLength;
+            const int numTaps = 2 * K;
+
+            // Kaiser window for ~90 dB stopband
+            const double beta = 0.1102 * (90.0 - 8.7);
+            const double centre = 2.0 * K - 1.0;
+            const double pi = juce::MathConstants<double>::pi;
+
+            taps.assign((size_t)numTaps, 0);
+            double sum = 0.0;
+            std::vector<double> h((size_t)numTaps);
+
+            for (int j = 0; j < numTaps; ++j)
+            {
+                const double m = 2.0 * j - centre; // Odd offsets from the centre
+                const double ratio = m / (centre + 1.0);
+                const double window = besselI0(beta * std::sqrt(juce::jmax(0.0, 1.0 - ratio * ratio))) / besselI0(beta);
+                h[(size_t)j] = std::sin(pi * m * 0.5) / (pi * m) * window;
+                sum += h[(size_t)j];
+            }
+
+            // Exact unity DC gain: the branch sums to 0.5, the centre tap adds the other half
+            for (int j = 0; j < numTaps; ++j)
+                taps[(size_t)j] = (SampleType)(h[(size_t)j] * 0.5 / sum);
+
+            upHistory.assign((size_t)((maxLowSamples + upHistoryLength()) * channels), 0);
+            evenHistory.assign((size_t)((maxLowSamples + upHistoryLength()) * channels), 0);
+            oddHistory.assign((size_t)((maxLowSamples + K) * channels), 0);
+            acc.assign((size_t)(maxLowSamples * channels), 0);
+        }
+
+        void reset()
+        {
+            std::fill(upHistory.begin(), upHistory.end(), (SampleType)0);
+            std::fill(evenHistory.begin(), evenHistory.end(), (SampleType)0);
+            std::fill(oddHistory.begin(), oddHistory.end(), (SampleType)0);
+        }
+
+        /** Low-rate samples, up and down combined: (K - 1/2) each way. */
+        int getRoundTrip() const { return 2 * K - 1; }
+
+        template <int C>
+        void up(Port in, Port out, int numSamples)
+        {
+            // y[2n] = 2 * sum h[2j] x[n - j],  y[2n + 1] = x[n - K + 1]
+            const int H = upHistoryLength();
+            SampleType* x = upHistory.data();
+            append<C>(x, H, in, numSamples);
+
+            convolve<C>(x, H, numSamples, (SampleType)2);
+
+            const SampleType* delayed = x + C * (H - K + 1);
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const int o = 2 * i * out.stride;
+                out.l[o] = acc[(size_t)(C * i)];
+                out.l[o + out.stride] = delayed[C * i];
+
+                if constexpr (C == 2)
+                {
+                    out.r[o] = acc[(size_t)(2 * i + 1)];
+                    out.r[o + out.stride] = delayed[2 * i + 1];
+                }
+            }
+
+            retain<C>(x, H, numSamples);
+        }
+
+        template <int C>
+        void down(Port in, Port out, int numSamples)
+        {
+            // y[n] = sum h[2j] v[2(n - j)] + 0.5 * v[2(n - K) + 1]
+            const int H = upHistoryLength();
+            SampleType* even = evenHistory.data();
+            SampleType* odd = oddHistory.data();
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const int e = 2 * i * in.stride;
+                const int o = e + in.stride;
+                even[C * (H + i)] = in.l[e];
+                odd[C * (K + i)] = in.l[o];
+
+                if constexpr (C == 2)
+                {
+                    even[2 * (H + i) + 1] = in.r[e];
+                    odd[2 * (K + i) + 1] = in.r[o];
+                }
+            }
+
+            convolve<C>(even, H, numSamples, (SampleType)1);
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                out.l[i * out.stride] = acc[(size_t)(C * i)] + (SampleType)0.5 * odd[C * i];
+
+                if constexpr (C == 2)
+                    out.r[i * out.stride] = acc[(size_t)(2 * i + 1)] + (SampleType)0.5 * odd[2 * i + 1];
+            }
+
+            retain<C>(even, H, numSamples);
+            retain<C>(odd, K, numSamples);
+        }
+
+        /** Interleaved frames of Lanes channels, as up<2>() / down<2>() do for L/R. */
+        template <int Lanes>
+        void upLanes(const SampleType* in, SampleType* out, int numSamples)
+        {
+            const int H = upHistoryLength();
+            SampleType* x = upHistory.data();
+            std::memcpy(x + Lanes * H, in, sizeof(SampleType) * (size_t)(Lanes * numSamples));
+
+            convolve<Lanes>(x, H, numSamples, (SampleType)2);
+
+            const SampleType* delayed = x + Lanes * (H - K + 1);
+            for (int i = 0; i < numSamples; ++i)
+            {
+                for (int k = 0; k < Lanes; ++k)
+                {
+                    out[Lanes * 2 * i + k] = acc[(size_t)(Lanes * i + k)];
+                    out[Lanes * (2 * i + 1) + k] = delayed[Lanes * i + k];
+                }
+            }
+
+            retain<Lanes>(x, H, numSamples);
+        }
+
+        template <int Lanes>
+        void downLanes(const SampleType* in, SampleType* out, int numSamples)
+        {
+            const int H = upHistoryLength();
+            SampleType* even = evenHistory.data();
+            SampleType* odd = oddHistory.data();
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                for (int k = 0; k < Lanes; ++k)
+                {
+                    even[Lanes * (H + i) + k] = in[Lanes * 2 * i + k];
+                    odd[Lanes * (K + i) + k] = in[Lanes * (2 * i + 1) + k];
+                }
+            }
+
+            convolve<Lanes>(even, H, numSamples, (SampleType)1);
+
+            for (int i = 0; i < Lanes * numSamples; ++i)
+                out[i] = acc[(size_t)i] + (SampleType)0.5 * odd[i];
+
+            retain<Lanes>(even, H, numSamples);
+            retain<Lanes>(odd, K, numSamples);
+        }
+
+        int upHistoryLength() const { return 2 * K - 1; }
+
+        template <int C>
+        static void append(SampleType* x, int historyLength, Port in, int numSamples)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                x[C * (historyLength + i)] = in.l[i * in.stride];
+                if constexpr (C == 2) x[2 * (historyLength + i) + 1] = in.r[i * in.stride];
+            }
+        }
+
+        template <int C>
+        static void retain(SampleType* x, int historyLength, int numSamples)
+        {
+            std::memmove(x, x + C * numSamples, sizeof(SampleType) * (size_t)(C * historyLength));
+        }
+
+        /** acc[n] = gain * sum_j taps[j] * x[n - j] over frames of C channels, history H frames deep. */
+        template <int C>
+        void convolve(const SampleType* x, int H, int numSamples, SampleType gain)
+        {
+            SampleType* a = acc.data();
+            const int numValues = C * numSamples;
+            std::fill(a, a + numValues, (SampleType)0);
+
+            for (int j = 0; j < 2 * K; ++j)
+            {
+                const SampleType t = taps[(size_t)j] * gain;
+                const SampleType* src = x + C * (H - j);
+
+                for (int i = 0; i < numValues; ++i)
+                    a[i] += t * src[i];
+            }
+        }
+
+        static double besselI0(double x)
+        {
+            double sum = 1.0, term = 1.0;
+            for (int k = 1; k < 50 && term > 1.0e-12 * sum; ++k)
+            {
+                term *= (x * 0.5 / k) * (x * 0.5 / k);
+                sum += term;
+            }
+            return sum;
+        }
+
+        int K = 1;
+        std::vector<SampleType> taps, upHistory, evenHistory, oddHistory, acc;
+    };
+
+    /** FIR round trip of the first `stages` stages, in top-rate samples: stage s contributes (2K - 1) at its lower rate. */
+    int getTopDelay(int stages) const
+    {
+        int topDelay = 0;
+        for (int s = 0; s < stages; ++s)
+            topDelay += fir[s].getRoundTrip() << (stages - s);
+        return topDelay;
+    }
+
+    //==============================================================================
+    /** Delays the top-rate signal by topPad samples: the FIR round trip becomes the requested whole host samples. */
+    void applyPad(int numTopSamples)
+    {
+        // Interleaved, the frames are one stream and the delay is topPad frames of it
+        if (interleaved)
+        {
+            padIndex = delayInPlace(upBuffer[0].data(), padLine[0].data(), numTopSamples * numChannels,
+                                    topPad * numChannels, padIndex);
+            return;
+        }
+
+        int index = padIndex;
+        for (int ch = 0; ch < numChannels; ++ch)
+            index = delayInPlace(upBuffer[(size_t)ch].data(), padLine[ch].data(), numTopSamples, topPad, padIndex);
+
+        padIndex = index;
+    }
+
+    /** data[i] goes into the circular line of `length` at `index`; returns the index after the last sample. */
+    static int delayInPlace(SampleType* data, SampleType* line, int numSamples, int length, int index)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const SampleType delayed = line[index];
+            line[index] = data[i];
+            data[i] = delayed;
+            index = index + 1 == length ? 0 : index + 1;
+        }
+
+        return index;
+    }
+
+    struct IIRSpec
+    {
+        int numCoefs;
+        double transition;
+    };
+
+    // IIR: ~100 dB image rejection at every stage. Later stages only pass content
+    // below a quarter of their input rate, so they get away with far fewer taps.
+    static constexpr IIRSpec iirSpecs[maxStages] = { { 8, 0.04 }, { 4, 0.20 }, { 2, 0.35 } };
+    static constexpr int firHalfLengths[maxStages] = { 24, 8, 6 };
+
+    IIRStage iir[maxStages];
+    FIRStage fir[maxStages];
+
+    int factor = 4;
+    int numStages = 2;
+    int numChannels = 2;
+    bool interleaved = false;
+    OversamplingFilter filter = OversamplingFilter::PolyphaseIIR;
+    int maxBaseSamples = 0;
+    double latency = 0.0;
+
+    int topPad = 0;
+    int padIndex = 0;
+    std::vector<SampleType> padLine[2], upBuffer[2], scratch[2], discard;
+};
+
+} // namespace aether
@@ -0,0 +1,297 @@
+/*
+  ==============================================================================
+
+    AetherParameters.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Typed per-block parameter snapshot and per-sample smoothing ramps.
+
+    ParameterCache looks every APVTS atomic up once (string hashing happens in
+    the constructor, never on the audio thread) and builds a ParameterSnapshot
+    per block. ParameterRamp turns block-rate targets into per-sample ramps,
+    but only renders anything while a value is actually moving.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherCommon.h"
+#include "AetherPresets.h"
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <vector>
+
+namespace aether
+{
+
+/**
+ * ParameterSnapshot: every engine parameter, typed, for one block.
+ */
+struct ParameterSnapshot
+{
+    // Distortion
+    float drive = 0.5f;
+    int stages = 1;
+    DistortionAlgo algoPos = DistortionAlgo::SoftClip;
+    DistortionAlgo algoNeg = DistortionAlgo::SoftClip;
+    float fold = 0.0f;
+
+    // Filter
+    float cutoff = 20000.0f;
+    float res = 0.2f;
+    float morph = 0.0f;
+    bool vowelMode = false;
+
+    // Feedback / Resonator
+    float fbAmount = 0.0f;
+    float fbTime = 20.0f;
+    float scramble = 0.0f;
+
+    // Neuro / DnB
+    float sub = 1.0f;
+    float squeeze = 0.0f;
+    float width = 0.0f;
+    float xover = 150.0f;
+
+    // Noise
+    float noiseLevel = 0.0f;
+    float noiseWidth = 0.0f;
+    int noiseType = 0;
+
+    // Global
+    float mix = 1.0f;
+    float outputDb = 0.0f;
+    bool cpuGovernor = false;
+    bool linearPhase = false;
+    bool linearCrossover = false;
+    bool lfeToSub = false; // Surround buses: LFE bypasses the crossover into the sub path
+    double bpm = 120.0;
+
+    /** Overrides the fields a factory preset defines (values already legal). */
+    void applyPreset(const PresetData& p)
+    {
+        drive = p.drive;
+        stages = (int)p.stages;
+        algoPos = (DistortionAlgo)p.algoPos;
+        algoNeg = (DistortionAlgo)p.algoNeg;
+        cutoff = p.cutoff;
+        res = p.res;
+        morph = p.morph;
+        fbAmount = p.fbAmount;
+        fbTime = p.fbTime;
+        mix = p.mix;
+        sub = p.subLevel;
+        squeeze = p.squeeze;
+    }
+};
+
+/**
+ * ParameterCache: APVTS atomics resolved once, read lock-free every block.
+ */
+class ParameterCache
+{
+public:
+    explicit ParameterCache(juce::AudioProcessorValueTreeState& apvts)
+        : drive(get(apvts, "drive")), stages(get(apvts, "stages")),
+          algoPos(get(apvts, "algoPos")), algoNeg(get(apvts, "algoNeg")),
+          fold(get(apvts, "fold")), cutoff(get(apvts, "cutoff")),
+          res(get(apvts, "res")), morph(get(apvts, "morph")),
+          filterMode(get(apvts, "filterMode")), fbAmount(get(apvts, "fbAmount")),
+          fbTime(get(apvts, "fbTime")), scramble(get(apvts, "scramble")),
+          sub(get(apvts, "sub")), squeeze(get(apvts, "squeeze")),
+          width(get(apvts, "width")), xover(get(apvts, "xover")),
+          noiseLevel(get(apvts, "noiseLevel")), noiseWidth(get(apvts, "noiseWidth")),
+          noiseType(get(apvts, "noiseType")), mix(get(apvts, "mix")),
+          output(get(apvts, "output")), cpuGovernor(get(apvts, "cpuGovernor")),
+          linearPhase(get(apvts, "linearPhase")), linearCrossover(get(apvts, "linearCrossover")),
+          lfeToSub(get(apvts, "lfeToSub"))
+    {
+    }
+
+    ParameterSnapshot load() const
+    {
+        ParameterSnapshot p;
+        p.drive = drive.load(std::memory_order_relaxed);
+        p.stages = (int)stages.load(std::memory_order_relaxed);
+        p.algoPos = (DistortionAlgo)(int)algoPos.load(std::memory_order_relaxed);
+        p.algoNeg = (DistortionAlgo)(int)algoNeg.load(std::memory_order_relaxed);
+        p.fold = fold.load(std::memory_order_relaxed);
+        p.cutoff = cutoff.load(std::memory_order_relaxed);
+        p.res = res.load(std::memory_order_relaxed);
+        p.morph = morph.load(std::memory_order_relaxed);
+        p.vowelMode = filterMode.load(std::memory_order_relaxed) > 0.5f;
+        p.fbAmount = fbAmount.load(std::memory_order_relaxed);
+        p.fbTime = fbTime.load(std::memory_order_relaxed);
+        p.scramble = scramble.load(std::memory_order_relaxed);
+        p.sub = sub.load(std::memory_order_relaxed);
+        p.squeeze = squeeze.load(std::memory_order_relaxed);
+        p.width = width.load(std::memory_order_relaxed);
+        p.xover = xover.load(std::memory_order_relaxed);
+        p.noiseLevel = noiseLevel.load(std::memory_order_relaxed);
+        p.noiseWidth = noiseWidth.load(std::memory_order_relaxed);
+        p.noiseType = (int)noiseType.load(std::memory_order_relaxed);
+        p.mix = mix.load(std::memory_order_relaxed);
+        p.outputDb = output.load(std::memory_order_relaxed);
+        p.cpuGovernor = cpuGovernor.load(std::memory_order_relaxed) > 0.5f;
+        p.linearPhase = linearPhase.load(std::memory_order_relaxed) > 0.5f;
+        p.linearCrossover = linearCrossover.load(std::memory_order_relaxed) > 0.5f;
+        p.lfeToSub = lfeToSub.load(std::memory_order_relaxed) > 0.5f;
+        return p;
+    }
+
+private:
+    static std::atomic<float>& get(juce::AudioProcessorValueTreeState& apvts, const char* id)
+    {
+        auto* value = apvts.getRawParameterValue(id);
+        jassert(value != nullptr); // Parameter ID out of sync with createParameterLayout()
+        return *value;
+    }
+
+    std::atomic<float>& drive;
+    std::atomic<float>& stages;
+    std::atomic<float>& algoPos;
+    std::atomic<float>& algoNeg;
+    std::atomic<float>& fold;
+    std::atomic<float>& cutoff;
+    std::atomic<float>& res;
+    std::atomic<float>& morph;
+    std::atomic<float>& filterMode;
+    std::atomic<float>& fbAmount;
+    std::atomic<float>& fbTime;
+    std::atomic<float>& scramble;
+    std::atomic<float>& sub;
+    std::atomic<float>& squeeze;
+    std::atomic<float>& width;
+    std::atomic<float>& xover;
+    std::atomic<float>& noiseLevel;
+    std::atomic<float>& noiseWidth;
+    std::atomic<float>& noiseType;
+    std::atomic<float>& mix;
+    std::atomic<float>& output;
+    std::atomic<float>& cpuGovernor;
+    std::atomic<float>& linearPhase;
+    std::atomic<float>& linearCrossover;
+    std::atomic<float>& lfeToSub;
+};
+
+/**
+ * ParameterRamp: block-rate target in, per-sample ramp out.
+ *
+ * setTarget() once per block, then render(n). While settled, render() writes
+ * nothing and get(i) returns the constant value, so unchanged parameters cost
+ * one predictable branch per read. Ramps are written as independent-lane
+ * loops so the compiler emits SIMD for both shapes.
+ */
+class ParameterRamp
+{
+public:
+    enum class Shape
+    {
+        Linear,
+        Exponential // Constant ratio per sample: for Hz, ms and gain values
+    };
+
+    void prepare(double sampleRate, int maxBlockSize, double rampSeconds, Shape newShape)
+    {
+        shape = newShape;
+        rampLength = juce::jmax(1, (int)(sampleRate * rampSeconds));
+        ramp.assign((size_t)juce::jmax(1, maxBlockSize), 0.0f);
+        active = false;
+    }
+
+    /** Jumps straight to a value (first block, resets). */
+    void reset(float value)
+    {
+        current = target = value;
+        remaining = 0;
+        active = false;
+    }
+
+    void setTarget(float newTarget)
+    {
+        if (newTarget == target) return;
+
+        target = newTarget;
+        remaining = rampLength;
+
+        // Exponential needs both ends on the same side of zero
+        exponentialSegment = shape == Shape::Exponential && current > 0.0f && target > 0.0f;
+
+        if (exponentialSegment)
+            step = std::pow(target / current, 1.0f / (float)rampLength);
+        else
+            step = (target - current) / (float)rampLength;
+    }
+
+    /** Advances the ramp by numSamples. Returns true if values moved this block. */
+    bool render(int numSamples)
+    {
+        active = remaining > 0;
+        if (!active) return false;
+
+        jassert(numSamples <= (int)ramp.size());
+        numSamples = juce::jmin(numSamples, (int)ramp.size());
+
+        const int n = juce::jmin(numSamples, remaining);
+        float* out = ramp.data();
+
+        if (exponentialSegment)
+        {
+            // Four interleaved geometric sequences with stride step^4
+            float lane[4];
+            lane[0] = current * step;
+            for (int k = 1; k < 4; ++k) lane[k] = lane[k - 1] * step;
+            const float stride = lane[3] / current;
+
+            int i = 0;
+            for (; i + 4 <= n; i += 4)
+                for (int k = 0; k < 4; ++k)
+                {
+                    out[i + k] = lane[k];
+                    lane[k] *= stride;
+                }
+
+            for (int k = 0; i < n; ++i, ++k)
+                out[i] = lane[k];
+        }
+        else
+        {
+            const float start = current;
+            for (int i = 0; i < n; ++i)
+                out[i] = start + step * (float)(i + 1);
+        }
+
+        remaining -= n;
+        current = remaining == 0 ? target : out[n - 1];
+
+        if (n < numSamples)
+            juce::FloatVectorOperations::fill(out + n, target, numSamples - n);
+
+        return true;
+    }
+
+    /** Value at sample i of the last rendered block. */
+    float get(int i) const { return active ? ramp[(size_t)i] : current; }
+
+    /** The rendered ramp, or nullptr if the value was constant for the last block. */
+    const float* getRamp() const { return active ? ramp.data() : nullptr; }
+
+    bool isActive() const { return active; }
+    float getCurrent() const { return current; }
+    float getTarget() const { return target; }
+
+private:
+    Shape shape = Shape::Linear;
+    std::vector<float> ramp;
+    int rampLength = 1;
+    int remaining = 0;
+    float current = 0.0f;
+    float target = 0.0f;
+    float step = 0.0f;
+    bool exponentialSegment = false;
+    bool active = false;
+};
+
+} // namespace aether
@@ -0,0 +1,340 @@
+/*
+  ==============================================================================
+
+    AetherProfiler.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Per-stage timing of the engine: where an expensive instance spends its
+    time (oversampler, distortion, formant filter, resonator, output...).
+
+    Compiled in with AETHER_PROFILING=1, which debug builds default to.
+    Otherwise StageClock is empty and every lap compiles away.
+
+    The audio thread adds each stage's ticks into the current block. At the
+    end of the block they go into per-stage histograms of µs/block and a
+    smoothed average, plain atomics the UI reads without locking. While a
+    trace is recording, every lap is also appended to a buffer allocated up
+    front, which the message thread writes out as Chrome trace JSON (open
+    it in ui.perfetto.dev or chrome://tracing).
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+
+#ifndef AETHER_PROFILING
+ #if JUCE_DEBUG
+  #define AETHER_PROFILING 1
+ #else
+  #define AETHER_PROFILING 0
+ #endif
+#endif
+
+namespace aether
+{
+
+/** The stages of AetherEngine::processTile, in signal order, then the processor's dry/wet and gain. */
+enum class ProfileStage
+{
+    Noise,
+    Split,
+    Lows,
+    Upsample,
+    Modulation,
+    Fold,
+    DistortionFilter,
+    Resonator,
+    Dimension,
+    Squeeze,
+    Downsample,
+    Output,
+    Mix,
+    Count
+};
+
+inline const char* getStageName(ProfileStage stage)
+{
+    static const char* const names[] = { "noise", "split", "lows", "upsample", "modulation", "fold",
+                                         "distortion+filter", "resonator", "dimension", "squeeze",
+                                         "downsample", "output", "mix" };
+    static_assert(sizeof(names) / sizeof(names[0]) == (size_t)ProfileStage::Count, "One name per stage");
+    return names[(int)stage];
+}
+
+/**
+ * StageProfiler: one per processor. The audio thread records, the message
+ * thread reads statistics and owns the trace file.
+ */
+class StageProfiler
+{
+public:
+    static constexpr int numStages = (int)ProfileStage::Count;
+
+    // Quarter-octave buckets of µs/block from 0.25 µs up (the last one is open-ended, ~14 ms)
+    static constexpr int numBuckets = 64;
+    static constexpr double firstBucketUs = 0.25;
+
+    // About 20 s of a stereo instance at 48 kHz with every stage on
+    static constexpr int maxTraceEvents = 1 << 20;
+
+    static constexpr bool isEnabled() { return AETHER_PROFILING != 0; }
+
+    StageProfiler() : microsecondsPerTick(1.0e6 / (double)juce::Time::getHighResolutionTicksPerSecond()) {}
+
+    static juce::int64 now() { return juce::Time::getHighResolutionTicks(); }
+
+    // --- Audio thread ---
+
+    void beginBlock(juce::int64 startTicks)
+    {
+        blockStart = startTicks;
+        blockTicks.fill(0);
+    }
+
+    /** One stage ran from `start` to `end` (ticks) in engine group `group` (-1: the processor). Any number of times per block. */
+    void add(ProfileStage stage, juce::int64 start, juce::int64 end, int group)
+    {
+        blockTicks[(size_t)stage] += end - start;
+
+        if (tracing.load(std::memory_order_acquire))
+            appendTraceEvent((int)stage, start, end, group, 0);
+    }
+
+    void endBlock(int numSamples)
+    {
+        const auto end = now();
+
+        if (resetRequested.exchange(false, std::memory_order_acquire))
+        {
+            for (auto& stage : histogram)
+                for (auto& bucket : stage)
+                    bucket.store(0, std::memory_order_relaxed);
+
+            blocks.store(0, std::memory_order_relaxed);
+        }
+
+        const bool first = blocks.load(std::memory_order_relaxed) == 0;
+
+        for (int s = 0; s < numStages; ++s)
+            record(s, (double)blockTicks[(size_t)s] * microsecondsPerTick, first);
+
+        record(numStages, (double)(end - blockStart) * microsecondsPerTick, first);
+        blocks.store(blocks.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+        if (tracing.load(std::memory_order_acquire))
+            appendTraceEvent(numStages, blockStart, end, 0, numSamples);
+    }
+
+    // --- Message thread ---
+
+    struct Stats
+    {
+        float averageUs = 0.0f; // Smoothed over roughly the last 100 blocks
+        float p99Us = 0.0f;     // Upper edge of the histogram bucket (quarter-octave resolution)
+    };
+
+    struct Snapshot
+    {
+        std::array<Stats, numStages> stages;
+        Stats block; // The whole processBlock, stages and everything between them
+        juce::uint32 numBlocks = 0;
+    };
+
+    Snapshot getSnapshot() const
+    {
+        Snapshot snapshot;
+        snapshot.numBlocks = blocks.load(std::memory_order_acquire);
+
+        for (int s = 0; s < numStages; ++s)
+            snapshot.stages[(size_t)s] = getStats(s);
+
+        snapshot.block = getStats(numStages);
+        return snapshot;
+    }
+
+    /** Clears the histograms at the end of the next block. */
+    void resetStats() { resetRequested.store(true, std::memory_order_release); }
+
+    /** Starts recording trace events, discarding any unsaved ones. Allocates the buffer the first time. */
+    void startTrace()
+    {
+        if (traceEvents == nullptr)
+            traceEvents.reset(new TraceEvent[(size_t)maxTraceEvents]);
+
+        traceCount.store(0, std::memory_order_relaxed);
+        traceStart = now();
+        tracing.store(true, std::memory_order_release);
+    }
+
+    bool isTracing() const { return tracing.load(std::memory_order_relaxed); }
+    bool isTraceFull() const { return traceCount.load(std::memory_order_relaxed) >= maxTraceEvents; }
+
+    /** Stops recording and writes what was recorded to `file` as Chrome trace JSON. */
+    juce::Result stopTrace(const juce::File& file)
+    {
+        tracing.store(false, std::memory_order_release);
+
+        // An append in flight finishes beyond this count, so it is never read half-written
+        const int count = traceCount.load(std::memory_order_acquire);
+
+        juce::FileOutputStream out(file);
+        if (!out.openedOk())
+            return juce::Result::fail("Could not open " + file.getFullPathName());
+
+        out.setPosition(0);
+        out.truncate();
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+        for (int i = 0; i < count; ++i)
+        {
+            const auto& e = traceEvents[(size_t)i];
+            const bool block = e.stage == numStages;
+
+            out << (i > 0 ? ",\n" : "")
+                << "{\"name\":\"" << (block ? "block" : getStageName((ProfileStage)e.stage)) << "\""
+                << ",\"cat\":\"" << (block || e.group < 0 ? "processor" : "engine") << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+                << ",\"ts\":" << juce::String((double)(e.start - traceStart) * microsecondsPerTick, 3)
+                << ",\"dur\":" << juce::String((double)(e.end - e.start) * microsecondsPerTick, 3)
+                << ",\"args\":{" << (block ? "\"samples\":" : "\"group\":") << (block ? e.samples : e.group) << "}}";
+        }
+
+        out << "\n]}\n";
+        out.flush();
+
+        return out.getStatus();
+    }
+
+private:
+    struct TraceEvent
+    {
+        juce::int64 start = 0, end = 0;
+        int stage = 0; // numStages: the whole block
+        int group = 0;
+        int samples = 0;
+    };
+
+    static int getBucket(double us)
+    {
+        if (us <= firstBucketUs) return 0;
+        return juce::jmin(numBuckets - 1, 1 + (int)(4.0 * std::log2(us / firstBucketUs)));
+    }
+
+    static double getBucketUpperUs(int bucket) { return firstBucketUs * std::exp2(bucket / 4.0); }
+
+    // Single writer, so load + store instead of read-modify-write
+    void record(int index, double us, bool first)
+    {
+        auto& bucket = histogram[(size_t)index][(size_t)getBucket(us)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        auto& average = averageUs[(size_t)index];
+        const float previous = first ? (float)us : average.load(std::memory_order_relaxed);
+        average.store(previous + 0.01f * ((float)us - previous), std::memory_order_relaxed);
+    }
+
+    Stats getStats(int index) const
+    {
+        Stats stats;
+        stats.averageUs = averageUs[(size_t)index].load(std::memory_order_relaxed);
+
+        std::array<juce::uint32, numBuckets> counts;
+        juce::uint64 total = 0;
+
+        for (int b = 0; b < numBuckets; ++b)
+            total += counts[(size_t)b] = histogram[(size_t)index][(size_t)b].load(std::memory_order_relaxed);
+
+        juce::uint64 seen = 0;
+
+        for (int b = 0; b < numBuckets && total > 0; ++b)
+        {
+            seen += counts[(size_t)b];
+            if (seen * 100 >= total * 99)
+            {
+                stats.p99Us = (float)getBucketUpperUs(b);
+                break;
+            }
+        }
+
+        return stats;
+    }
+
+    void appendTraceEvent(int stage, juce::int64 start, juce::int64 end, int group, int numSamples)
+    {
+        int index = traceCount.load(std::memory_order_relaxed);
+        if (index >= maxTraceEvents) return;
+
+        traceEvents[(size_t)index] = { start, end, stage, group, numSamples };
+
+        // Fails only if the message thread restarted the trace meanwhile: then the event is dropped
+        traceCount.compare_exchange_strong(index, index + 1, std::memory_order_release, std::memory_order_relaxed);
+    }
+
+    const double microsecondsPerTick;
+
+    // Audio thread
+    juce::int64 blockStart = 0;
+    std::array<juce::int64, numStages> blockTicks {};
+
+    // Audio -> UI; the extra row is the whole block
+    std::array<std::array<std::atomic<juce::uint32>, numBuckets>, numStages + 1> histogram {};
+    std::array<std::atomic<float>, numStages + 1> averageUs {};
+    std::atomic<juce::uint32> blocks { 0 };
+    std::atomic<bool> resetRequested { false };
+
+    // Trace: allocated by the first startTrace() and kept until destruction, so the audio thread never sees it move
+    std::unique_ptr<TraceEvent[]> traceEvents;
+    std::atomic<int> traceCount { 0 };
+    std::atomic<bool> tracing { false };
+    juce::int64 traceStart = 0;
+
+    JUCE_DECLARE_NON_COPYABLE (StageProfiler)
+};
+
+/**
+ * StageClock: laps through consecutive stages on the audio thread. Each lap
+ * charges the time since the previous one (or construction) to a stage.
+ * Does nothing without a profiler, and is empty unless AETHER_PROFILING.
+ */
+class StageClock
+{
+public:
+#if AETHER_PROFILING
+    StageClock(StageProfiler* p, int groupIndex)
+        : profiler(p), group(groupIndex), last(p != nullptr ? StageProfiler::now() : 0) {}
+
+    void lap(ProfileStage stage)
+    {
+        if (profiler == nullptr) return;
+
+        const auto t = StageProfiler::now();
+        profiler->add(stage, last, t, group);
+        last = t;
+    }
+
+    /** Starts the next stage now, without charging the time since the last lap to anything. */
+    void restart()
+    {
+        if (profiler != nullptr) last = StageProfiler::now();
+    }
+
+private:
+    StageProfiler* profiler;
+    int group;
+    juce::int64 last;
+#else
+    StageClock(StageProfiler*, int) {}
+    void lap(ProfileStage) {}
+    void restart() {}
+#endif
+};
+
+} // namespace aether
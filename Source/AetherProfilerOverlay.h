@@ -0,0 +1,183 @@
+/*
+  ==============================================================================
+
+    AetherProfilerOverlay.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Developer overlay, toggled by a Ctrl+Shift click on the logo. Shows the
+    processor's health counters and latest events, and with AETHER_PROFILING
+    the live µs/block of every engine stage. In profiling builds, clicking
+    the overlay starts a Chrome trace and clicking again writes it to the
+    temp directory.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "AetherProfiler.h"
+#include "AetherHealth.h"
+
+namespace aether
+{
+
+    class AetherProfilerOverlay : public juce::Component,
+                                  private juce::Timer
+    {
+    public:
+        AetherProfilerOverlay(StageProfiler& p, const HealthMonitor& h) : profiler(p), health(h)
+        {
+            setInterceptsMouseClicks(true, false);
+        }
+
+        ~AetherProfilerOverlay() override
+        {
+            // Never leave the audio thread appending to a trace nobody will save
+            if (profiler.isTracing()) stopTrace();
+        }
+
+        void visibilityChanged() override
+        {
+            if (isVisible())
+            {
+                profiler.resetStats();
+                startTimerHz(10);
+            }
+            else
+            {
+                stopTimer();
+            }
+        }
+
+        void mouseDown(const juce::MouseEvent&) override
+        {
+            if (!StageProfiler::isEnabled()) return;
+
+            if (profiler.isTracing())
+            {
+                stopTrace();
+            }
+            else
+            {
+                profiler.startTrace();
+                status = "tracing... click to save";
+            }
+
+            repaint();
+        }
+
+        void paint(juce::Graphics& g) override
+        {
+            g.fillAll(juce::Colour(0xe0050505));
+            g.setColour(juce::Colour(0xff00d4ff).withAlpha(0.6f));
+            g.drawRect(getLocalBounds(), 1);
+
+            auto bounds = getLocalBounds().reduced(8);
+            g.setFont(juce::Font(juce::FontOptions(juce::Font::getDefaultMonospacedFontName(), 12.0f, juce::Font::plain)));
+
+            paintHealth(g, bounds.removeFromRight(bounds.getWidth() / 2));
+
+            auto area = bounds;
+
+            if (!StageProfiler::isEnabled())
+            {
+                g.setColour(juce::Colours::darkgrey);
+                g.drawFittedText("stage timings: build with AETHER_PROFILING", area.removeFromTop(30), juce::Justification::topLeft, 2);
+                return;
+            }
+
+            auto row = [&](const juce::String& name, float average, float p99, juce::Colour colour)
+            {
+                auto line = area.removeFromTop(15);
+                g.setColour(colour);
+                g.drawText(name, line.removeFromLeft(130), juce::Justification::centredLeft);
+                g.drawText(juce::String(average, 1), line.removeFromLeft(60), juce::Justification::centredRight);
+                g.drawText(juce::String(p99, 1), line.removeFromLeft(60), juce::Justification::centredRight);
+            };
+
+            auto header = area.removeFromTop(15);
+            g.setColour(juce::Colours::white);
+            g.drawText("STAGE", header.removeFromLeft(130), juce::Justification::centredLeft);
+            g.drawText("avg us", header.removeFromLeft(60), juce::Justification::centredRight);
+            g.drawText("p99", header.removeFromLeft(60), juce::Justification::centredRight);
+
+            float stageTotal = 0.0f;
+
+            for (int s = 0; s < StageProfiler::numStages; ++s)
+            {
+                const auto& stats = snapshot.stages[(size_t)s];
+                stageTotal += stats.averageUs;
+
+                // Stages that did not run stay dim
+                const auto colour = stats.averageUs > 0.0f ? juce::Colours::lightgrey : juce::Colours::darkgrey;
+                row(getStageName((ProfileStage)s), stats.averageUs, stats.p99Us, colour);
+            }
+
+            // Ramps, commands, parameter reads and the timers themselves
+            row("other", juce::jmax(0.0f, snapshot.block.averageUs - stageTotal), 0.0f, juce::Colours::darkgrey);
+            row("block", snapshot.block.averageUs, snapshot.block.p99Us, juce::Colour(0xff00d4ff));
+
+            area.removeFromTop(6);
+            g.setColour(juce::Colours::lightgrey);
+            g.drawText(juce::String(snapshot.numBlocks) + " blocks", area.removeFromTop(15), juce::Justification::centredLeft);
+            g.drawFittedText(status, area.removeFromTop(30), juce::Justification::topLeft, 2);
+        }
+
+    private:
+        void paintHealth(juce::Graphics& g, juce::Rectangle<int> area)
+        {
+            g.setColour(juce::Colours::white);
+            g.drawText("HEALTH", area.removeFromTop(15), juce::Justification::centredLeft);
+
+            for (int e = 0; e < HealthMonitor::numEvents; ++e)
+            {
+                const auto count = health.getCount((HealthEvent)e);
+                auto line = area.removeFromTop(15);
+
+                g.setColour(count > 0 ? juce::Colours::lightgrey : juce::Colours::darkgrey);
+                g.drawText(getHealthEventName((HealthEvent)e), line.removeFromLeft(120), juce::Justification::centredLeft);
+                g.drawText(juce::String((juce::int64)count), line, juce::Justification::centredRight);
+            }
+
+            area.removeFromTop(6);
+
+            // Newest last, as in the host state
+            HealthMonitor::Entry recent[8];
+            const int numRecent = health.getRecent(recent, 8);
+
+            g.setColour(juce::Colours::lightgrey);
+            for (int i = 0; i < numRecent; ++i)
+                g.drawText(juce::Time(recent[i].timeMs).formatted("%H:%M:%S ") + getHealthEventName(recent[i].event)
+                               + " " + juce::String(recent[i].value),
+                           area.removeFromTop(15), juce::Justification::centredLeft);
+        }
+
+        void timerCallback() override
+        {
+            snapshot = profiler.getSnapshot();
+
+            if (profiler.isTracing() && profiler.isTraceFull())
+                status = "trace buffer full, click to save";
+
+            repaint();
+        }
+
+        void stopTrace()
+        {
+            const auto file = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                                  .getChildFile("aether_trace_" + juce::Time::getCurrentTime().formatted("%Y%m%d_%H%M%S") + ".json");
+
+            const auto result = profiler.stopTrace(file);
+            status = result.wasOk() ? "saved " + file.getFullPathName() : result.getErrorMessage();
+        }
+
+        StageProfiler& profiler;
+        const HealthMonitor& health;
+        StageProfiler::Snapshot snapshot;
+        juce::String status { "click to record a trace" };
+    };
+
+} // namespace aether
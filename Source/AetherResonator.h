@@ -27,12 +27,27 @@ public:
         lfo.setParams(0.5f, AetherLFO::Waveform::Sine); // Slow breather
     }
 
+    /** Retunes to a new rate without clearing or reallocating the delay line. */
+    void setSampleRate(double newRate)
+    {
+        sampleRate = (float)newRate;
+        lfo.prepare(newRate);
+    }
+
     void reset()
     {
         std::fill(buffer.begin(), buffer.end(), 0.0f);
         writeIndex = 0;
     }
 
+    /** Non-finite samples kept out of the feedback line since the last call. Audio thread. */
+    int takeRecoveries()
+    {
+        const int n = recoveries;
+        recoveries = 0;
+        return n;
+    }
+
     /**
      * @param feedback Feedback amount (0 to 1.0+)
      * @param timeMs Delay time in milliseconds
@@ -69,8 +84,7 @@ public:
         if (!std::isfinite(saturated)) 
         {
             saturated = 0.0f;
-            // Optional: You could reset the whole buffer here if things went really wrong, 
-            // but correcting the stream is usually enough to recover.
+            ++recoveries;
         }
         
         buffer[writeIndex] = saturated;
@@ -83,6 +97,102 @@ private:
     float sampleRate = 44100.0f;
     std::vector<SampleType> buffer;
     int writeIndex = 0;
+    int recoveries = 0; // Guard trips since takeRecoveries()
+    AetherLFO lfo;
+};
+
+/**
+ * AetherResonator over interleaved frames of up to maxLanes channels: one
+ * LFO and one read position for every lane, the delay line interleaved the
+ * same way, so each frame reads and writes one contiguous run. Each lane
+ * matches its own AetherResonator sample for sample.
+ */
+template <typename SampleType>
+class AetherLaneResonator
+{
+public:
+    static constexpr int maxLanes = 8;
+    static constexpr int length = 192000; // Frames: ~4s at 48k, as AetherResonator
+
+    /** Message thread. Allocates the line for numLanes channels. */
+    void prepare(const juce::dsp::ProcessSpec& spec, int numLanes)
+    {
+        jassert(numLanes >= 1 && numLanes <= maxLanes);
+        lanes = numLanes;
+        buffer.assign((size_t)length * (size_t)lanes, 0);
+        sampleRate = (float)spec.sampleRate;
+        reset();
+        lfo.prepare(spec.sampleRate);
+        lfo.setParams(0.5f, AetherLFO::Waveform::Sine); // Slow breather
+    }
+
+    /** Retunes to a new rate without clearing or reallocating the delay line. */
+    void setSampleRate(double newRate)
+    {
+        sampleRate = (float)newRate;
+        lfo.prepare(newRate);
+    }
+
+    void reset()
+    {
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
+        writeIndex = 0;
+    }
+
+    int takeRecoveries()
+    {
+        const int n = recoveries;
+        recoveries = 0;
+        return n;
+    }
+
+    /** One frame of Lanes channels (the prepared count) in place; parameters as AetherResonator::processSample(). */
+    template <int Lanes>
+    void processFrame(SampleType* x, float feedback, float timeMs, float plasma = 0.0f)
+    {
+        jassert(Lanes == lanes);
+        float lfoVal = lfo.getNextSample();
+        
+        float modTime = timeMs + (lfoVal * plasma * 10.0f); 
+        float delaySamples = (modTime / 1000.0f) * sampleRate;
+        
+        float readPos = (float)writeIndex - delaySamples;
+        while (readPos < 0) readPos += (float)length;
+        
+        int i1 = (int)readPos;
+        int i2 = (i1 + 1) % length;
+        float frac = readPos - (float)i1;
+
+        const SampleType* a = buffer.data() + (size_t)i1 * Lanes;
+        const SampleType* b = buffer.data() + (size_t)i2 * Lanes;
+        SampleType* w = buffer.data() + (size_t)writeIndex * Lanes;
+        const float drive = 1.0f + plasma * 0.5f;
+
+        for (int k = 0; k < Lanes; ++k)
+        {
+            SampleType delayedSample = a[k] * (1.0f - frac) + b[k] * frac;
+            SampleType output = x[k] + delayedSample * feedback;
+            SampleType saturated = std::tanh(output * drive);
+            
+            if (!std::isfinite(saturated)) 
+            {
+                saturated = 0.0f;
+                ++recoveries;
+            }
+            
+            w[k] = saturated;
+            x[k] = output;
+        }
+
+        writeIndex = (writeIndex + 1) % length;
+    }
+
+private:
+    float sampleRate = 44100.0f;
+    std::vector<SampleType> buffer; // length frames of `lanes` channels
+    int lanes = 1;
+    int writeIndex = 0;
+    int recoveries = 0;
     AetherLFO lfo;
 };
 
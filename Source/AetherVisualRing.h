@@ -0,0 +1,192 @@
+/*
+  ==============================================================================
+
+    AetherVisualRing.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Lock-free single-producer ring of stereo frames for the UI.
+
+    The audio thread bulk-writes a whole block and publishes it with one
+    release store. Any number of UI readers (spectrum, scope, orb, meters)
+    each own a Reader with a private cursor, so readers never contend with
+    each other or with the writer. A reader that falls more than half a ring
+    behind is moved forward to the oldest frame that is still intact.
+
+    A reader preempted mid-copy can still be lapped. Frames are relaxed
+    atomics, and the writer claims the range it is about to overwrite
+    before touching it (a seqlock without the retry): after copying, a
+    reader drops whatever the latest claim reaches, so it never returns a
+    torn frame.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace aether
+{
+
+struct StereoFrame
+{
+    float left = 0.0f;
+    float right = 0.0f;
+};
+
+template <int CapacityFrames>
+class VisualRing
+{
+public:
+    static_assert(CapacityFrames > 0 && (CapacityFrames & (CapacityFrames - 1)) == 0,
+                  "VisualRing capacity must be a power of two");
+
+    static constexpr int capacity = CapacityFrames;
+
+    // The writer never publishes more than this per call, so frames within `safeSpan`
+    // of the write position are only overwritten if a reader is preempted mid-copy
+    static constexpr int safeSpan = CapacityFrames / 2;
+
+    /** Audio thread only. Mono blocks are duplicated into both sides of the frame. */
+    void write(const juce::AudioBuffer<float>& block)
+    {
+        write(block, 0, block.getNumSamples());
+    }
+
+    void write(const juce::AudioBuffer<float>& block, int startSample, int numSamples)
+    {
+        if (numSamples <= 0 || block.getNumChannels() == 0) return;
+
+        auto pos = writePos.load(std::memory_order_relaxed);
+
+        // Oversized host blocks: only the newest frames can be seen by readers anyway
+        if (numSamples > safeSpan)
+        {
+            startSample += numSamples - safeSpan;
+            numSamples = safeSpan;
+        }
+
+        const float* l = block.getReadPointer(0, startSample);
+        const float* r = block.getNumChannels() > 1 ? block.getReadPointer(1, startSample) : l;
+
+        // Claim before writing: a reader that sees any of these stores also sees the claim
+        claimPos.store(pos + (uint64_t)numSamples, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            auto& f = frames[(pos + (uint64_t)i) & mask];
+            f.left.store(l[i], std::memory_order_relaxed);
+            f.right.store(r[i], std::memory_order_relaxed);
+        }
+
+        writePos.store(pos + (uint64_t)numSamples, std::memory_order_release);
+    }
+
+    /**
+     * Reader: one per consumer, owned and used by a single (UI) thread.
+     */
+    class Reader
+    {
+    public:
+        explicit Reader(const VisualRing& source)
+            : ring(source), cursor(source.writePos.load(std::memory_order_acquire)) {}
+
+        int getNumAvailable() const
+        {
+            auto w = ring.writePos.load(std::memory_order_acquire);
+            return (int)std::min<uint64_t>(w - cursor, (uint64_t)safeSpan);
+        }
+
+        /** Drops everything written so far (e.g. while a display is hidden). */
+        void skipToLatest()
+        {
+            cursor = ring.writePos.load(std::memory_order_acquire);
+        }
+
+        /** Oldest unread frames first. Returns the number of frames copied. */
+        int read(StereoFrame* dest, int maxFrames)
+        {
+            return copyOut(ring.writePos.load(std::memory_order_acquire), dest, maxFrames,
+                           [](float l, float r) { return StereoFrame { l, r }; });
+        }
+
+        /** Newest unread frames only; anything older is skipped. */
+        int readLatest(StereoFrame* dest, int maxFrames)
+        {
+            auto w = ring.writePos.load(std::memory_order_acquire);
+            if (w - cursor > (uint64_t)maxFrames)
+                cursor = w - (uint64_t)maxFrames;
+
+            return read(dest, maxFrames);
+        }
+
+        /** Like readLatest(), but folds each frame down to (L + R) / 2. */
+        int readLatestMono(float* dest, int maxFrames)
+        {
+            auto w = ring.writePos.load(std::memory_order_acquire);
+            if (w - cursor > (uint64_t)maxFrames)
+                cursor = w - (uint64_t)maxFrames;
+
+            return copyOut(w, dest, maxFrames, [](float l, float r) { return (l + r) * 0.5f; });
+        }
+
+    private:
+        /** Up to maxFrames from the cursor, each through convert(left, right); torn frames are dropped. */
+        template <typename T, typename Convert>
+        int copyOut(uint64_t w, T* dest, int maxFrames, Convert convert)
+        {
+            catchUp(w);
+
+            const int count = (int)std::min<uint64_t>(w - cursor, (uint64_t)maxFrames);
+            for (int i = 0; i < count; ++i)
+            {
+                const auto& f = ring.frames[(cursor + (uint64_t)i) & mask];
+                dest[i] = convert(f.left.load(std::memory_order_relaxed), f.right.load(std::memory_order_relaxed));
+            }
+
+            // Positions below claim - capacity may have been overwritten while we copied
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const auto claim = ring.claimPos.load(std::memory_order_relaxed);
+            const auto intactFrom = claim > (uint64_t)capacity ? claim - (uint64_t)capacity : 0;
+            const int torn = (int)std::min<uint64_t>(intactFrom > cursor ? intactFrom - cursor : 0, (uint64_t)count);
+
+            if (torn > 0)
+                std::copy(dest + torn, dest + count, dest);
+
+            cursor += (uint64_t)count;
+            return count - torn;
+        }
+
+        void catchUp(uint64_t w)
+        {
+            if (w - cursor > (uint64_t)safeSpan)
+                cursor = w - (uint64_t)safeSpan;
+        }
+
+        const VisualRing& ring;
+        uint64_t cursor = 0;
+    };
+
+private:
+    static constexpr uint64_t mask = (uint64_t)CapacityFrames - 1;
+
+    // Relaxed atomics: a lapped reader may race the writer, and drops what it read (see copyOut)
+    struct Slot
+    {
+        std::atomic<float> left { 0.0f };
+        std::atomic<float> right { 0.0f };
+    };
+
+    // Writer indices on their own cache line; frame storage starts on the next one
+    alignas(64) std::atomic<uint64_t> writePos { 0 };
+    std::atomic<uint64_t> claimPos { 0 }; // End of the range being written
+    alignas(64) Slot frames[CapacityFrames];
+};
+
+} // namespace aether
@@ -6,8 +6,12 @@ PhatRackAudioProcessorEditor::PhatRackAudioProcessorEditor (AetherAudioProcessor
     : AudioProcessorEditor (&p), audioProcessor (p),
       posSelector("POSITIVE", p.apvts, "algoPos"),
       negSelector("NEGATIVE", p.apvts, "algoNeg"),
-      tooltipWindow(this, 700)
+      tooltipWindow(this, 700),
+      spectrumReader(p.visualRing),
+      profilerOverlay(p.profiler, p.health)
 {
+    audioProcessor.openEditors.fetch_add(1);
+
     // Apply AETHER Global LookAndFeel
     setLookAndFeel(&aetherLF);
 
@@ -25,7 +29,7 @@ PhatRackAudioProcessorEditor::PhatRackAudioProcessorEditor (AetherAudioProcessor
     presetSelector.onChange = [this] {
         int id = presetSelector.getSelectedId();
         if (id > 1) {
-            aether::AetherPresets::loadPreset(audioProcessor.apvts, id - 2);
+            audioProcessor.loadFactoryPreset(id - 2);
             // Force slider updates
             repaint();
         }
@@ -47,6 +51,28 @@ PhatRackAudioProcessorEditor::PhatRackAudioProcessorEditor (AetherAudioProcessor
         // For simplicity, we just change the button color to show it's active.
     };
 
+    // CPU Governor
+    addAndMakeVisible(governorButton);
+    governorButton.setClickingTogglesState(true);
+    governorButton.setColour(juce::TextButton::buttonOnColourId, juce::Colour(0xff00d4ff)); // Cyan when Active
+    governorButton.setColour(juce::TextButton::textColourOnId, juce::Colours::black);
+    governorButton.setTooltip("CPU Governor: when ON and your system runs out of headroom, AETHER steps its quality down (control rate, oversampling, stages) instead of dropping out, and back up when things calm down.");
+    governorAtt = std::make_unique<ButtonAttachment>(audioProcessor.apvts, "cpuGovernor", governorButton);
+
+    addAndMakeVisible(linearPhaseButton);
+    linearPhaseButton.setClickingTogglesState(true);
+    linearPhaseButton.setColour(juce::TextButton::buttonOnColourId, juce::Colour(0xff00d4ff));
+    linearPhaseButton.setColour(juce::TextButton::textColourOnId, juce::Colours::black);
+    linearPhaseButton.setTooltip("Linear Phase: oversamples the high band with linear-phase filters so it stays phase-aligned with the sub. Adds a few ms of latency (reported to the host).");
+    linearPhaseAtt = std::make_unique<ButtonAttachment>(audioProcessor.apvts, "linearPhase", linearPhaseButton);
+
+    addAndMakeVisible(linearCrossoverButton);
+    linearCrossoverButton.setClickingTogglesState(true);
+    linearCrossoverButton.setColour(juce::TextButton::buttonOnColourId, juce::Colour(0xff00d4ff));
+    linearCrossoverButton.setColour(juce::TextButton::textColourOnId, juce::Colours::black);
+    linearCrossoverButton.setTooltip("Linear Phase Crossover: splits sub and highs without phase rotation, so transients stay intact. Adds about 25 ms of latency (reported to the host).");
+    linearCrossoverAtt = std::make_unique<ButtonAttachment>(audioProcessor.apvts, "linearCrossover", linearCrossoverButton);
+
     // --- 2. Central Stage ---
     // --- 2. Central Stage ---
     addAndMakeVisible(orb);     // Middle (The Orb)
@@ -58,6 +84,10 @@ PhatRackAudioProcessorEditor::PhatRackAudioProcessorEditor (AetherAudioProcessor
     negSelector.setTitleVisible(false);
     addAndMakeVisible(logo);
 
+    // Hidden developer overlay, on top of everything
+    addChildComponent(profilerOverlay);
+    logo.addMouseListener(this, false);
+
     // --- 3. Primary Distortion Controls ---
     driveSlider.setSliderStyle(juce::Slider::RotaryHorizontalVerticalDrag);
     driveSlider.setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
@@ -304,6 +334,7 @@ PhatRackAudioProcessorEditor::PhatRackAudioProcessorEditor (AetherAudioProcessor
 
 PhatRackAudioProcessorEditor::~PhatRackAudioProcessorEditor()
 {
+    audioProcessor.openEditors.fetch_sub(1);
     setLookAndFeel(nullptr);
 }
 
@@ -366,11 +397,16 @@ void PhatRackAudioProcessorEditor::resized()
     
     auto helpArea = header.removeFromRight(50).reduced(10);
     helpButton.setBounds(helpArea);
+
+    governorButton.setBounds(header.removeFromRight(70).reduced(10, 25));
+    linearPhaseButton.setBounds(header.removeFromRight(70).reduced(10, 25));
+    linearCrossoverButton.setBounds(header.removeFromRight(70).reduced(10, 25));
     
     auto presetArea = header.removeFromRight(200).reduced(15);
     presetSelector.setBounds(presetArea);
     
     logo.setBounds(header.removeFromLeft(300).reduced(10));
+    profilerOverlay.setBounds(10, 90, 560, 320);
     
     // --- 2. FOOTER / DECK (Bottom 100px) ---
     // --- 2. FOOTER / DECK (Bottom 135px) ---
@@ -594,12 +630,12 @@ void PhatRackAudioProcessorEditor::timerCallback()
     stagesReactor.setMorph(morph);
     
     // --- CYBER DECK SPECTRUM FEED (REAL AUDIO) ---
-    // Pull from the Audio FIFO populated by the Processor
+    // Pull from the visual ring populated by the Processor
     juce::AudioBuffer<float> vizNoise(1, 480); // 480 samples @ 48k is ~10ms. Enough for a snapshot.
     vizNoise.clear();
     
-    // Pull fresh data
-    audioProcessor.audioFifo.pull(vizNoise);
+    // Pull the freshest frames (older unread frames are skipped, the spectrum only shows "now")
+    spectrumReader.readLatestMono(vizNoise.getWritePointer(0), vizNoise.getNumSamples());
     
     // ANTAGRAVITY: Injecting Noise Floor ("Always Up" Aesthetic)
     if (drive > 0.01f)
@@ -622,9 +658,23 @@ void PhatRackAudioProcessorEditor::timerCallback()
     osc.setChaos(chaos_inject); 
     osc.setIntensity(fb_val);   
 
+    // Governor tier: "CPU" at full quality, "CPU -n" while stepped down
+    const int tier = audioProcessor.getQualityTier();
+    governorButton.setButtonText(tier > 0 ? "CPU -" + juce::String(tier) : "CPU");
+
     // REPAINT ORB (Physical Drift)
     logo.advance();
     logo.setMorph(morph);
 
     orb.repaint();
 }
+
+void PhatRackAudioProcessorEditor::mouseDown (const juce::MouseEvent& e)
+{
+    // Ctrl+Shift click on the logo: health counters, and per-stage timings when the build has them
+    if (e.eventComponent == &logo && e.mods.isCtrlDown() && e.mods.isShiftDown())
+    {
+        profilerOverlay.setVisible(!profilerOverlay.isVisible());
+        profilerOverlay.toFront(false);
+    }
+}
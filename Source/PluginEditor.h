@@ -10,6 +10,7 @@
 #include "AetherOrb.h"
 #include "AetherLogo.h"
 #include "AetherReactorTank.h"
+#include "AetherProfilerOverlay.h"
 
 // ...
 
@@ -28,6 +29,7 @@ public:
     void paintOverChildren (juce::Graphics&) override;
     void resized() override;
     void timerCallback() override;
+    void mouseDown (const juce::MouseEvent&) override;
 
 private:
     AetherAudioProcessor& audioProcessor;
@@ -61,10 +63,17 @@ private:
     aether::AetherOrb orb; // NEW CENTRAL CORE
     aether::AetherLogo logo; // NEW BRANDING
     aether::AetherSpectrum osc; // Output Spectrum
+    AetherAudioProcessor::VisualRing::Reader spectrumReader;
+
+    // Developer overlay: health counters and per-stage timings (Ctrl+Shift click on the logo)
+    aether::AetherProfilerOverlay profilerOverlay;
     
     // --- PRESETS & HELP ---
     juce::ComboBox presetSelector;
     juce::TextButton helpButton { "?" };
+    juce::TextButton governorButton { "CPU" }; // Opt-in CPU governor, shows the active tier
+    juce::TextButton linearPhaseButton { "LIN" }; // Linear-phase oversampling
+    juce::TextButton linearCrossoverButton { "XLIN" }; // Linear-phase crossover
     juce::Label presetLabel;
 
     // --- FILTER MODULE ---
@@ -91,7 +100,7 @@ private:
     using ButtonAttachment = juce::AudioProcessorValueTreeState::ButtonAttachment;
     
     std::unique_ptr<Attachment> driveAtt, cutoffAtt, resAtt, morphAtt;
-    std::unique_ptr<ButtonAttachment> filterModeAtt;
+    std::unique_ptr<ButtonAttachment> filterModeAtt, governorAtt, linearPhaseAtt, linearCrossoverAtt;
     std::unique_ptr<Attachment> fbAmountAtt, fbTimeAtt, outputAtt, mixAtt, subAtt, squeezeAtt;
     std::unique_ptr<Attachment> widthAtt, xoverAtt;
     std::unique_ptr<Attachment> foldAtt, spaceAtt;
@@ -1,5 +1,6 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "AetherPresets.h"
 
 AetherAudioProcessor::AetherAudioProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -10,10 +11,26 @@ AetherAudioProcessor::AetherAudioProcessor()
 #endif
 {
     formatManager.registerBasicFormats();
+    aetherEngine.setHealthMonitor(&health);
+
+    if (aether::StageProfiler::isEnabled())
+        aetherEngine.setProfiler(&profiler);
+
+    // Latency changes (linear phase, linear crossover, governor) are reported from here
+    startTimerHz(20);
 }
 
 AetherAudioProcessor::~AetherAudioProcessor()
 {
+    stopTimer();
+
+    // Audio has stopped: whatever is still in flight belongs to us now
+    aether::EngineCommand command;
+    while (commandQueue.pop(command))
+        command.freePayload();
+
+    freeRetiredPayloads();
+    delete activeSnapshot;
 }
 
 const juce::String AetherAudioProcessor::getName() const
@@ -50,7 +67,8 @@ bool AetherAudioProcessor::isMidiEffect() const
 
 double AetherAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    // Follows feedback, feedback time and width; infinite while the resonator self-oscillates
+    return aether::AetherEngine<float>::computeTailSeconds(parameters.load());
 }
 
 int AetherAudioProcessor::getNumPrograms()
@@ -81,15 +99,164 @@ void AetherAudioProcessor::loadCustomNoise(const juce::File& file)
     std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(file));
     if (reader)
     {
-        juce::AudioBuffer<float> newBuffer(reader->numChannels, (int)reader->lengthInSamples);
-        reader->read(&newBuffer, 0, (int)reader->lengthInSamples, 0, true, true);
-        
-        aetherEngine.setCustomNoise(newBuffer);
+        auto newBuffer = std::make_unique<juce::AudioBuffer<float>>((int)reader->numChannels, (int)reader->lengthInSamples);
+        reader->read(newBuffer.get(), 0, (int)reader->lengthInSamples, 0, true, true);
+        loadCustomNoise(std::move(newBuffer));
         
         // Note: UI updates param to "Custom" automatically
     }
 }
 
+void AetherAudioProcessor::loadCustomNoise(std::unique_ptr<juce::AudioBuffer<float>> newBuffer)
+{
+    if (newBuffer == nullptr) return;
+
+    aether::EngineCommand command;
+    command.type = aether::EngineCommand::Type::SwapNoise;
+    command.noise = newBuffer.get();
+
+    if (postCommand(command))
+        newBuffer.release(); // Now owned by the audio thread
+}
+
+void AetherAudioProcessor::loadFactoryPreset(int index)
+{
+    auto presets = aether::AetherPresets::getFactoryPresets();
+    if (index < 0 || index >= (int)presets.size()) return;
+
+    // The audio thread plays the whole preset from this snapshot while the
+    // parameters below are updated one by one. Begin is posted before the first
+    // write and End after the last, and processBlock() reads the parameters
+    // before it drains: a block that saw any write also sees Begin, so no block
+    // ever hears half a preset.
+    // Values are snapped through the parameter ranges so they match what the APVTS ends up holding.
+    auto legal = [this](const char* id, float value)
+    {
+        if (auto* p = apvts.getParameter(id))
+        {
+            auto range = p->getNormalisableRange();
+            return range.convertFrom0to1(range.convertTo0to1(value));
+        }
+        return value;
+    };
+
+    auto snapshot = std::make_unique<aether::PresetData>(presets[(size_t)index]);
+    snapshot->drive = legal("drive", snapshot->drive);
+    snapshot->cutoff = legal("cutoff", snapshot->cutoff);
+    snapshot->res = legal("res", snapshot->res);
+    snapshot->morph = legal("morph", snapshot->morph);
+    snapshot->fbAmount = legal("fbAmount", snapshot->fbAmount);
+    snapshot->fbTime = legal("fbTime", snapshot->fbTime);
+    snapshot->mix = legal("mix", snapshot->mix);
+    snapshot->subLevel = legal("sub", snapshot->subLevel);
+    snapshot->squeeze = legal("squeeze", snapshot->squeeze);
+
+    // Begin and End must both fit, otherwise the snapshot would never be released
+    const bool atomicLoad = commandQueue.getFreeSpace() >= 2;
+
+    if (atomicLoad)
+    {
+        aether::EngineCommand begin;
+        begin.type = aether::EngineCommand::Type::BeginSnapshot;
+        begin.snapshot = snapshot.get();
+
+        if (postCommand(begin))
+            snapshot.release();
+    }
+
+    aether::AetherPresets::loadPreset(apvts, index);
+
+    if (atomicLoad)
+    {
+        aether::EngineCommand end;
+        end.type = aether::EngineCommand::Type::EndSnapshot;
+        postCommand(end);
+    }
+}
+
+void AetherAudioProcessor::requestEngineReset()
+{
+    aether::EngineCommand command;
+    command.type = aether::EngineCommand::Type::Reset;
+    postCommand(command);
+}
+
+void AetherAudioProcessor::setEngineQuality(aether::EngineQuality quality)
+{
+    aether::EngineCommand command;
+    command.type = aether::EngineCommand::Type::SetQuality;
+    command.quality = quality;
+    postCommand(command);
+}
+
+bool AetherAudioProcessor::postCommand(aether::EngineCommand command)
+{
+    // Piggy-back on every post to free what the audio thread handed back
+    freeRetiredPayloads();
+
+    // Fails only if the audio thread hasn't drained anything for 64 commands
+    // (e.g. the host has suspended processing). Callers keep ownership then.
+    return commandQueue.push(command);
+}
+
+void AetherAudioProcessor::freeRetiredPayloads()
+{
+    aether::EngineCommand retired;
+    while (retiredQueue.pop(retired))
+        retired.freePayload();
+}
+
+void AetherAudioProcessor::retire(const aether::EngineCommand& command)
+{
+    if (command.noise == nullptr && command.snapshot == nullptr) return;
+
+    // Never free on the audio thread. The retired queue is as deep as the command
+    // queue and emptied on every post, so this can only fail if the message thread is gone.
+    if (!retiredQueue.push(command))
+        jassertfalse;
+}
+
+void AetherAudioProcessor::drainCommands()
+{
+    using Type = aether::EngineCommand::Type;
+
+    aether::EngineCommand command;
+    while (commandQueue.pop(command))
+    {
+        aether::EngineCommand displaced;
+
+        switch (command.type)
+        {
+            case Type::SwapNoise:
+                displaced.noise = aetherEngine.swapCustomNoise(command.noise);
+                break;
+
+            case Type::Reset:
+                aetherEngine.reset();
+                health.report(aether::HealthEvent::Reset, 1, -1);
+                break;
+
+            case Type::BeginSnapshot:
+                displaced.snapshot = activeSnapshot;
+                activeSnapshot = command.snapshot;
+                snapshotEnding = false;
+                break;
+
+            case Type::EndSnapshot:
+                // The parameters were read before this drain, possibly mid-load:
+                // the snapshot still covers this block and is released after it
+                snapshotEnding = true;
+                break;
+
+            case Type::SetQuality:
+                aetherEngine.setQuality(command.quality);
+                break;
+        }
+
+        retire(displaced);
+    }
+}
+
 void AetherAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
     juce::dsp::ProcessSpec spec;
@@ -97,13 +264,25 @@ void AetherAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock
     spec.maximumBlockSize = samplesPerBlock;
     spec.numChannels = getTotalNumOutputChannels();
 
-    aetherEngine.prepare(spec);
+    aetherEngine.prepare(spec, getChannelLayoutOfBus(false, 0));
+    governor.prepare(sampleRate);
     
     // Pre-allocate dry buffer to max block size and channel count
     dryBuffer.setSize(getTotalNumOutputChannels(), samplesPerBlock);
 
-    visualiser.setSamplesPerBlock(256);
-    visualiser.setBufferSize(1024);
+    // The dry signal is delayed by whatever latency the engine reports
+    dryDelay.prepare(getTotalNumOutputChannels(), aetherEngine.getMaxLatencySamples());
+    aetherEngine.setLinearPhase(parameters.load().linearPhase);
+    aetherEngine.setLinearCrossover(parameters.load().linearCrossover);
+    updateLatency();
+    setLatencySamples(engineLatency.load()); // Not the audio thread yet: report it right away
+
+    // Mix and output gain glide per sample; start settled on the current values
+    auto params = parameters.load();
+    mixRamp.prepare(sampleRate, samplesPerBlock, 0.02, aether::ParameterRamp::Shape::Linear);
+    mixRamp.reset(params.mix);
+    outputGainRamp.prepare(sampleRate, samplesPerBlock, 0.02, aether::ParameterRamp::Shape::Exponential);
+    outputGainRamp.reset(juce::Decibels::decibelsToGain(params.outputDb));
 }
 
 void AetherAudioProcessor::releaseResources()
@@ -117,18 +296,33 @@ bool AetherAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) c
     juce::ignoreUnused (layouts);
     return true;
   #else
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    const auto out = layouts.getMainOutputChannelSet();
+
+    if (out == juce::AudioChannelSet::mono() || out == juce::AudioChannelSet::stereo())
+        return true;
+
+    // Surround and discrete buses: each channel is processed in place, so in == out
+    if (out != layouts.getMainInputChannelSet())
         return false;
 
-    return true;
+    return out == juce::AudioChannelSet::quadraphonic()
+        || out == juce::AudioChannelSet::create5point0()
+        || out == juce::AudioChannelSet::create5point1()
+        || out == juce::AudioChannelSet::create7point0()
+        || out == juce::AudioChannelSet::create7point1()
+        || (out.isDiscreteLayout() && out.size() <= aether::AetherBusEngine::maxChannels);
   #endif
 }
 #endif
 
 void AetherAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    const auto startTicks = juce::Time::getHighResolutionTicks();
     juce::ScopedNoDenormals noDenormals;
+
+    if (aether::StageProfiler::isEnabled())
+        profiler.beginBlock(startTicks);
+
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -136,83 +330,184 @@ void AetherAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce:
         buffer.clear (i, 0, buffer.getNumSamples());
 
     // --- Params ---
-    float drive = apvts.getRawParameterValue("drive")->load();
-    int stages = (int)apvts.getRawParameterValue("stages")->load();
-    auto algoPos = (aether::DistortionAlgo)(int)apvts.getRawParameterValue("algoPos")->load();
-    auto algoNeg = (aether::DistortionAlgo)(int)apvts.getRawParameterValue("algoNeg")->load();
-    
-    float cutoff = apvts.getRawParameterValue("cutoff")->load();
-    float res = apvts.getRawParameterValue("res")->load();
-    float morph = apvts.getRawParameterValue("morph")->load();
-    
-    float fbAmount = apvts.getRawParameterValue("fbAmount")->load();
-    float fbTime = apvts.getRawParameterValue("fbTime")->load();
-    float scramble = *apvts.getRawParameterValue("scramble"); // Load Plasma
-    
-    float mix = apvts.getRawParameterValue("mix")->load();
-    float outputDb = apvts.getRawParameterValue("output")->load();
+    // One typed snapshot per block from cached atomics (no string lookups here).
+    // Read before the drain, so a preset load caught halfway has its Begin drained below.
+    auto params = parameters.load();
 
-    // Store Dry Signal for Mix (Zero Allocation)
-    // We only copy the active channels and samples for the current block
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    // --- Engine Commands ---
+    drainCommands();
+
+    // A preset load in progress: play the complete target preset, not the half-updated parameters
+    if (activeSnapshot != nullptr)
+        params.applyPreset(*activeSnapshot);
+
+    if (snapshotEnding)
     {
-        if (ch < dryBuffer.getNumChannels())
-            dryBuffer.copyFrom(ch, 0, buffer.getReadPointer(ch), buffer.getNumSamples());
+        aether::EngineCommand displaced;
+        displaced.snapshot = activeSnapshot;
+        activeSnapshot = nullptr;
+        snapshotEnding = false;
+        retire(displaced);
     }
-    float sub = *apvts.getRawParameterValue("sub");
-    float squeeze = *apvts.getRawParameterValue("squeeze");
-    float width = *apvts.getRawParameterValue("width");
-    float xover = *apvts.getRawParameterValue("xover");
-    
-    float fold = *apvts.getRawParameterValue("fold");
-    bool vowelMode = *apvts.getRawParameterValue("filterMode") > 0.5f;
 
     // --- Get BPM ---
-    double bpm = 120.0;
     if (auto* ph = getPlayHead())
     {
         if (auto pos = ph->getPosition())
             if (pos->getBpm().hasValue())
-                bpm = *pos->getBpm();
+                params.bpm = *pos->getBpm();
     }
 
-    float noiseLevel = apvts.getRawParameterValue("noiseLevel")->load();
-    float noiseWidth = apvts.getRawParameterValue("noiseWidth")->load();
-    int noiseType = (int)apvts.getRawParameterValue("noiseType")->load();
+    // Linear phase changes the latency: the engine restarts, the dry path follows
+    // at once and the host is told from the message thread (timerCallback)
+    aetherEngine.setLinearPhase(params.linearPhase);
+    aetherEngine.setLinearCrossover(params.linearCrossover);
+    updateLatency();
+
+    // Hosts may exceed the block size promised in prepareToPlay. The engine tiles
+    // internally; the dry copy and ramps here walk the block in prepared-size chunks.
+    const int chunkSize = juce::jmax(1, dryBuffer.getNumSamples());
+
+    for (int start = 0; start < buffer.getNumSamples(); start += chunkSize)
+    {
+        const int n = juce::jmin(chunkSize, buffer.getNumSamples() - start);
+        juce::AudioBuffer<float> chunk(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), start, n);
+        processChunk(chunk, params);
+    }
+
+    // --- CPU Governor ---
+    // Offline renders have no deadline, so they always run at full quality
+    if (params.cpuGovernor && !isNonRealtime())
+    {
+        const double elapsed = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+        aetherEngine.setTier(governor.update(elapsed, buffer.getNumSamples()));
+    }
+    else if (governor.getTier() != 0 || aetherEngine.getTier() != 0)
+    {
+        governor.reset();
+        aetherEngine.setTier(0);
+    }
+
+    const int tier = aetherEngine.getTier();
+    const int previousTier = qualityTier.exchange(tier, std::memory_order_relaxed);
+
+    if (tier != previousTier)
+        health.report(tier > previousTier ? aether::HealthEvent::QualityDown : aether::HealthEvent::QualityUp, tier, -1);
+
+    publishMeters(buffer);
+
+    if (aether::StageProfiler::isEnabled())
+        profiler.endBlock(buffer.getNumSamples());
+}
+
+void AetherAudioProcessor::processChunk (juce::AudioBuffer<float>& buffer, const aether::ParameterSnapshot& params)
+{
+    // Dry copy, mix and output gain are timed as one stage; the engine times its own
+    aether::StageClock clock(&profiler, -1);
+
+    // Store Dry Signal for Mix (Zero Allocation)
+    // We only copy the active channels and samples for the current block
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    {
+        if (ch < dryBuffer.getNumChannels())
+        {
+            dryBuffer.copyFrom(ch, 0, buffer.getReadPointer(ch), buffer.getNumSamples());
+            dryDelay.process(dryBuffer.getWritePointer(ch), ch, buffer.getNumSamples());
+        }
+    }
+
+    clock.lap(aether::ProfileStage::Mix);
 
     // Process Audio
-    aetherEngine.process(buffer, drive, 0.0f, stages, algoPos, algoNeg, cutoff, res, morph, fbAmount, fbTime, scramble, sub, squeeze, bpm, width, xover, fold, vowelMode, noiseLevel, noiseWidth, noiseType);
+    aetherEngine.process(buffer, params);
+    clock.restart();
     
+    const int numSamples = buffer.getNumSamples();
+
     // Apply Mix
     // Apply Mix (Standard Linear Crossfade)
     // "Parallel Chain" feel: Ensure we blend properly without volume dip bug
+    mixRamp.setTarget(params.mix);
+    mixRamp.render(numSamples);
+
+    // Standard Mix: Wet*Mix + Dry*(1-Mix)
+    // This allows full Wet (Mix=1) and full Dry (Mix=0)
+    const auto& simd = aether::kernels::get();
+
     for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        simd.dryWetMix(buffer.getWritePointer(ch), dryBuffer.getReadPointer(ch),
+                       mixRamp.getRamp(), mixRamp.getCurrent(), numSamples);
+
+    // Publish the whole block to the UI in one go (stereo frames, single atomic store).
+    // Nothing else on the audio thread touches visualisation state.
+    if (openEditors.load(std::memory_order_relaxed) > 0)
+        visualRing.write(buffer);
+
+    // Final Output Gain
+    outputGainRamp.setTarget(juce::Decibels::decibelsToGain(params.outputDb));
+
+    if (outputGainRamp.render(numSamples))
     {
-        auto* wet = buffer.getWritePointer(ch);
-        const auto* dry = dryBuffer.getReadPointer(ch);
-        
-        for (int s = 0; s < buffer.getNumSamples(); ++s)
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            juce::FloatVectorOperations::multiply(buffer.getWritePointer(ch), outputGainRamp.getRamp(), numSamples);
+    }
+    else
+    {
+        buffer.applyGain(outputGainRamp.getCurrent());
+    }
+
+    clock.lap(aether::ProfileStage::Mix);
+}
+
+void AetherAudioProcessor::publishMeters (const juce::AudioBuffer<float>& buffer)
+{
+    const int numChannels = juce::jmin(buffer.getNumChannels(), getTotalNumOutputChannels());
+    const int numSamples = buffer.getNumSamples();
+    if (numChannels == 0 || numSamples == 0) return;
+
+    float peak = 0.0f, sumSquares = 0.0f;
+    int clipped = 0;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const auto* data = buffer.getReadPointer(ch);
+
+        for (int s = 0; s < numSamples; ++s)
         {
-            // Standard Mix: Wet*Mix + Dry*(1-Mix)
-            // This allows full Wet (Mix=1) and full Dry (Mix=0)
-            wet[s] = wet[s] * mix + dry[s] * (1.0f - mix);
+            const float a = std::abs(data[s]);
+            peak = juce::jmax(peak, a);
+            sumSquares += a * a;
+            clipped += a >= 1.0f ? 1 : 0;
         }
     }
 
-    for (int s = 0; s < buffer.getNumSamples(); ++s)
+    outputPeak.store(peak, std::memory_order_relaxed);
+    outputMeter.store(std::sqrt(sumSquares / (float)(numChannels * numSamples)), std::memory_order_relaxed);
+
+    // Every clipped sample is counted, but a run of clipping blocks is one event
+    if (clipped > 0)
     {
-        // Average channels for mono visualizer
-        float sum = 0;
-        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-            sum += buffer.getSample(ch, s);
-        audioFifo.push(sum / buffer.getNumChannels());
+        if (clipping) health.count(aether::HealthEvent::Clip, clipped);
+        else health.report(aether::HealthEvent::Clip, clipped, -1);
     }
 
-    visualiser.pushBuffer(buffer);
+    clipping = clipped > 0;
+}
 
-    // Final Output Gain
-    float gain = juce::Decibels::decibelsToGain(outputDb);
-    buffer.applyGain(gain);
+void AetherAudioProcessor::updateLatency()
+{
+    const int latency = aetherEngine.getLatencySamples();
+    dryDelay.setDelay(latency);
+    engineLatency.store(latency, std::memory_order_relaxed);
+}
+
+void AetherAudioProcessor::timerCallback()
+{
+    // Hosts may lock or post from setLatencySamples(), so it never runs in processBlock
+    const int latency = engineLatency.load(std::memory_order_relaxed);
+
+    if (latency != getLatencySamples())
+        setLatencySamples(latency);
 }
 
 bool AetherAudioProcessor::hasEditor() const
@@ -228,6 +523,7 @@ juce::AudioProcessorEditor* AetherAudioProcessor::createEditor()
 void AetherAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
     auto state = apvts.copyState();
+    state.appendChild(createHealthState(), nullptr); // Read-only diagnostics, ignored on load
     std::unique_ptr<juce::XmlElement> xml (state.createXml());
     copyXmlToBinary (*xml, destData);
 }
@@ -237,7 +533,37 @@ void AetherAudioProcessor::setStateInformation (const void* data, int sizeInByte
     std::unique_ptr<juce::XmlElement> xmlState (getXmlFromBinary (data, sizeInBytes));
     if (xmlState.get() != nullptr)
         if (xmlState->hasTagName (apvts.state.getType()))
-            apvts.replaceState (juce::ValueTree::fromXml (*xmlState));
+        {
+            auto state = juce::ValueTree::fromXml (*xmlState);
+            state.removeChild (state.getChildWithName ("Health"), nullptr); // Counters belong to the session that saved them
+            apvts.replaceState (state);
+            requestEngineReset(); // Don't let the previous session's tails ring into the new one
+        }
+}
+
+juce::ValueTree AetherAudioProcessor::createHealthState() const
+{
+    // Every counter since this instance was created, and the latest events
+    juce::ValueTree tree ("Health");
+
+    for (int e = 0; e < aether::HealthMonitor::numEvents; ++e)
+        tree.setProperty (aether::getHealthEventName ((aether::HealthEvent)e),
+                          (juce::int64)health.getCount ((aether::HealthEvent)e), nullptr);
+
+    aether::HealthMonitor::Entry recent[32];
+    const int numRecent = health.getRecent (recent, 32);
+
+    for (int i = 0; i < numRecent; ++i)
+    {
+        juce::ValueTree event ("Event");
+        event.setProperty ("time", juce::Time (recent[i].timeMs).toISO8601 (true), nullptr);
+        event.setProperty ("type", aether::getHealthEventName (recent[i].event), nullptr);
+        event.setProperty ("group", recent[i].group, nullptr);
+        event.setProperty ("value", recent[i].value, nullptr);
+        tree.appendChild (event, nullptr);
+    }
+
+    return tree;
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout AetherAudioProcessor::createParameterLayout()
@@ -283,6 +609,10 @@ juce::AudioProcessorValueTreeState::ParameterLayout AetherAudioProcessor::create
     // --- Global & UI ---
     layout.add(std::make_unique<juce::AudioParameterFloat>("output", "Output Gain", juce::NormalisableRange<float>(-24.0f, 24.0f, 0.1f), 0.0f));
     layout.add(std::make_unique<juce::AudioParameterFloat>("mix", "Dry/Wet", 0.0f, 1.0f, 1.0f));
+    layout.add(std::make_unique<juce::AudioParameterBool>("cpuGovernor", "CPU Governor", false)); // Opt-in: trades quality for headroom under overload
+    layout.add(std::make_unique<juce::AudioParameterBool>("linearPhase", "Linear Phase", false)); // Linear-phase oversampling, adds latency
+    layout.add(std::make_unique<juce::AudioParameterBool>("linearCrossover", "Linear Phase Crossover", false)); // FFT crossover, adds latency
+    layout.add(std::make_unique<juce::AudioParameterBool>("lfeToSub", "LFE To Sub", false)); // Surround buses only
 
     // --- Noise Engine ---
     layout.add(std::make_unique<juce::AudioParameterFloat>("noiseLevel", "Noise Level", 0.0f, 1.0f, 0.0f));
@@ -3,9 +3,14 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_audio_utils/juce_audio_utils.h>
 #include <juce_dsp/juce_dsp.h>
+#include "AetherBusEngine.h"
 #include "AetherDSP.h"
+#include "AetherVisualRing.h"
+#include "AetherCommandQueue.h"
+#include "AetherParameters.h"
 
-class AetherAudioProcessor  : public juce::AudioProcessor
+class AetherAudioProcessor  : public juce::AudioProcessor,
+                              private juce::Timer
 {
 public:
     AetherAudioProcessor();
@@ -42,48 +47,71 @@ public:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     juce::AudioProcessorValueTreeState apvts {*this, nullptr, "Parameters", createParameterLayout()};
 
-    // Audio Visualization FIFO
-    struct AudioFIFO {
-        static constexpr int size = 4096;
-        float buffer[size] {0};
-        std::atomic<int> writeIndex {0};
-        std::atomic<int> readIndex {0};
-        
-        void push(float samples) {
-            buffer[writeIndex.load() % size] = samples;
-            writeIndex++;
-        }
-        
-        void pull(juce::AudioBuffer<float>& out) {
-            int w = writeIndex.load();
-            int r = readIndex.load();
-            int count = std::min((int)out.getNumSamples(), w - r);
-            if (count <= 0) return;
-            
-            auto* d = out.getWritePointer(0);
-            for (int i=0; i<count; ++i) {
-                d[i] = buffer[(r + i) % size];
-            }
-            readIndex += count;
-        }
-    } audioFifo;
-
-    // Waveform Data
-    juce::AudioVisualiserComponent visualiser { 1 };
-
-    // Custom Noise Loading
+    // Audio Visualization Ring (audio thread writes, each UI consumer owns a Reader)
+    using VisualRing = aether::VisualRing<8192>;
+    VisualRing visualRing;
+
+    // Number of open editors. The ring is only fed while someone is looking,
+    // so headless instances never touch it.
+    std::atomic<int> openEditors { 0 };
+
+    // --- Engine Commands (message thread) ---
+    // Non-parameter actions are queued lock-free and applied at the top of the
+    // next processBlock. Payloads the engine lets go of are freed back here.
     void loadCustomNoise(const juce::File& file);
+    void loadCustomNoise(std::unique_ptr<juce::AudioBuffer<float>> buffer); // Already decoded
+    void loadFactoryPreset(int index);
+    void requestEngineReset();
+    void setEngineQuality(aether::EngineQuality quality);
     juce::AudioFormatManager formatManager;
     
-    // RMS Meter for UI
+    // Output meters for the UI, published every block (RMS over the channels, and sample peak)
     std::atomic<float> outputMeter { 0.0f };
+    std::atomic<float> outputPeak { 0.0f };
+
+    // Resets, guard recoveries, clipping, sleep and governor steps. Also saved with the host state.
+    aether::HealthMonitor health;
+
+    // CPU governor tier the engine is running at (0 = full quality), for the UI
+    int getQualityTier() const { return qualityTier.load(std::memory_order_relaxed); }
+
+    // Per-stage timings for the developer overlay (only fed when AETHER_PROFILING is on)
+    aether::StageProfiler profiler;
 
 private:
-    // The AETHER Engine
-    aether::AetherEngine<float> aetherEngine;
+    bool postCommand(aether::EngineCommand command);
+    void freeRetiredPayloads();
+    void drainCommands(); // Audio thread
+    void processChunk(juce::AudioBuffer<float>& buffer, const aether::ParameterSnapshot& params);
+    void publishMeters(const juce::AudioBuffer<float>& buffer); // Audio thread, also counts clipping
+    juce::ValueTree createHealthState() const;
+    void retire(const aether::EngineCommand& command); // Audio thread
+    void updateLatency(); // Audio thread: delays the dry path to the engine's latency and publishes it
+    void timerCallback() override; // Message thread: reports a changed latency to the host
+
+    // Cached parameter atomics (declared after apvts, which it reads from)
+    aether::ParameterCache parameters { apvts };
+    aether::ParameterRamp mixRamp, outputGainRamp;
+
+    // The AETHER Engine: one per channel group of the main bus
+    aether::AetherBusEngine aetherEngine;
+
+    // Opt-in ("cpuGovernor"): realtime block timings drive the engine's quality tier
+    aether::QualityGovernor governor;
+    std::atomic<int> qualityTier { 0 };
+    bool clipping = false; // The previous block clipped (a run is logged once)
+
+    aether::EngineCommandQueue commandQueue; // Message -> Audio
+    aether::EngineCommandQueue retiredQueue; // Audio -> Message (payloads to free)
+    const aether::PresetData* activeSnapshot = nullptr; // Audio thread, owned
+    bool snapshotEnding = false; // Audio thread: EndSnapshot drained, release after this block
 
     // Pre-allocated buffer for dry signal to avoid allocation in audio thread
     juce::AudioBuffer<float> dryBuffer;
+    aether::DelayCompensation<float> dryDelay;
+
+    // Latency the engine runs at (written by the audio thread); the host hears of it from the timer
+    std::atomic<int> engineLatency { 0 };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AetherAudioProcessor)
 };
@@ -0,0 +1,425 @@
+/*
+  ==============================================================================
+
+    AetherGolden.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Golden-output checks: a render is compared against a stored reference
+    with the tolerance its case asks for.
+
+      BitExact  every sample identical
+      Db120     error energy at least 120 dB below the reference energy
+                (survives compiler and libm rounding, catches anything audible)
+      Spectral  third-octave band levels within 0.75 dB on average (for
+                noise, where only the spectrum is meaningful; another seed
+                measures about 0.4 dB, another noise colour 0.5 to 1.9 dB)
+
+    The render side is shared by the suites that hold an engine to a
+    reference or to another engine: the case description, the busy patch,
+    the fixed input and the stereo render.
+
+    References are raw little-endian float32, channels one after the other,
+    behind a small header, so they round-trip bit-exactly on every host.
+    PROVENANCE.txt beside them names the build that rendered them: JUCE's
+    FFT and the host libm and ISA all leave their mark below audibility.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherBenchCorpus.h"
+#include "AetherDSP.h"
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace aether
+{
+namespace test
+{
+
+enum class Tolerance
+{
+    BitExact,
+    Db120,
+    Spectral
+};
+
+inline const char* toleranceName(Tolerance t)
+{
+    switch (t)
+    {
+        case Tolerance::BitExact: return "bit-exact";
+        case Tolerance::Db120:    return "-120 dB";
+        case Tolerance::Spectral: return "spectral";
+    }
+    return "";
+}
+
+struct Comparison
+{
+    bool passed = false;
+    std::string detail; // Measured distance, for the log
+};
+
+/** Rendered audio: numChannels planes of numSamples each. */
+struct Render
+{
+    int numChannels = 0;
+    int numSamples = 0;
+    std::vector<float> samples;
+
+    const float* channel(int ch) const { return samples.data() + (size_t)ch * (size_t)numSamples; }
+};
+
+// --- Reference files ---
+
+constexpr char referenceMagic[8] = { 'A', 'E', 'T', 'H', 'R', 'E', 'F', '1' };
+
+inline bool writeReference(const std::string& path, const Render& render)
+{
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (f == nullptr) return false;
+
+    const int32_t header[2] = { render.numChannels, render.numSamples };
+    bool ok = std::fwrite(referenceMagic, sizeof(referenceMagic), 1, f) == 1
+           && std::fwrite(header, sizeof(header), 1, f) == 1
+           && std::fwrite(render.samples.data(), sizeof(float), render.samples.size(), f) == render.samples.size();
+
+    return std::fclose(f) == 0 && ok;
+}
+
+/** False if the file is missing or not a reference. */
+inline bool readReference(const std::string& path, Render& render)
+{
+    FILE* f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) return false;
+
+    char magic[sizeof(referenceMagic)] = {};
+    int32_t header[2] = {};
+    bool ok = std::fread(magic, sizeof(magic), 1, f) == 1
+           && std::memcmp(magic, referenceMagic, sizeof(magic)) == 0
+           && std::fread(header, sizeof(header), 1, f) == 1
+           && header[0] > 0 && header[1] > 0;
+
+    if (ok)
+    {
+        render.numChannels = header[0];
+        render.numSamples = header[1];
+        render.samples.resize((size_t)header[0] * (size_t)header[1]);
+        ok = std::fread(render.samples.data(), sizeof(float), render.samples.size(), f) == render.samples.size();
+    }
+
+    std::fclose(f);
+    return ok;
+}
+
+/** JUCE version, compiler, OS and CPU of this build, one line. */
+inline std::string describeBuild()
+{
+    std::string text;
+
+   #if defined (JUCE_MAJOR_VERSION)
+    text = "JUCE " + std::to_string(JUCE_MAJOR_VERSION) + "." + std::to_string(JUCE_MINOR_VERSION)
+         + "." + std::to_string(JUCE_BUILDNUMBER);
+   #else
+    text = "stand-in JUCE headers";
+   #endif
+
+   #if defined (__clang__)
+    text += ", Clang " __clang_version__;
+   #elif defined (__GNUC__)
+    text += ", GCC " + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+   #elif defined (_MSC_VER)
+    text += ", MSVC " + std::to_string(_MSC_VER);
+   #endif
+
+   #if defined (_WIN32)
+    text += ", Windows";
+   #elif defined (__APPLE__)
+    text += ", macOS";
+   #elif defined (__linux__)
+    text += ", Linux";
+   #endif
+
+   #if defined (__x86_64__) || defined (_M_X64)
+    text += " x86_64";
+   #elif defined (__aarch64__) || defined (_M_ARM64)
+    text += " arm64";
+   #endif
+
+    return text;
+}
+
+inline bool writeProvenance(const std::string& path)
+{
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (f == nullptr) return false;
+
+    const bool ok = std::fprintf(f, "%s\n", describeBuild().c_str()) > 0;
+    return std::fclose(f) == 0 && ok;
+}
+
+/** The build line written by writeProvenance(); empty if there is none. */
+inline std::string readProvenance(const std::string& path)
+{
+    FILE* f = std::fopen(path.c_str(), "r");
+    if (f == nullptr) return {};
+
+    char line[256] = {};
+    const bool ok = std::fgets(line, sizeof(line), f) != nullptr;
+    std::fclose(f);
+
+    std::string text = ok ? line : "";
+    while (! text.empty() && (text.back() == '\n' || text.back() == '\r'))
+        text.pop_back();
+    return text;
+}
+
+// --- Distances ---
+
+inline bool bitExact(const Render& a, const Render& b)
+{
+    return a.numChannels == b.numChannels && a.numSamples == b.numSamples
+        && std::memcmp(a.samples.data(), b.samples.data(), a.samples.size() * sizeof(float)) == 0;
+}
+
+/** Error energy relative to the reference energy in dB (absolute, per sample, if the reference is silent). */
+inline double errorDb(const Render& out, const Render& ref)
+{
+    double error = 0.0, energy = 0.0;
+    for (size_t i = 0; i < ref.samples.size(); ++i)
+    {
+        const double e = (double)out.samples[i] - (double)ref.samples[i];
+        error += e * e;
+        energy += (double)ref.samples[i] * ref.samples[i];
+    }
+
+    if (error == 0.0) return -400.0; // Identical
+    return 10.0 * std::log10(error / (energy > 0.0 ? energy : (double)ref.samples.size()));
+}
+
+/**
+ * Mean absolute difference, in dB, of the third-octave band levels of the
+ * two renders. Band levels come from the power spectrum averaged over
+ * Hann-windowed frames of 1024 with 50% overlap, so two different noise
+ * sequences of the same colour measure close to 0. Bands more than 100 dB
+ * below the loudest band in both renders are left out: they are noise floor.
+ */
+inline double spectralDistanceDb(const Render& out, const Render& ref)
+{
+    constexpr int order = 10, size = 1 << order, hop = size / 2, numBins = size / 2 + 1;
+    juce::dsp::FFT fft(order);
+    std::vector<float> frame((size_t)size * 2), window((size_t)size);
+
+    for (int i = 0; i < size; ++i)
+        window[(size_t)i] = 0.5f - 0.5f * std::cos(2.0f * juce::MathConstants<float>::pi * (float)i / (float)size);
+
+    // Third-octave bands from bin 8 up (about 375 Hz at 48 kHz): narrower bands hold too few bins to average
+    auto bandLevelsDb = [&](const Render& r, int ch)
+    {
+        std::vector<double> power((size_t)numBins, 0.0);
+
+        for (int start = 0; start + size <= r.numSamples; start += hop)
+        {
+            std::fill(frame.begin(), frame.end(), 0.0f);
+            for (int i = 0; i < size; ++i)
+                frame[(size_t)i] = r.channel(ch)[start + i] * window[(size_t)i];
+
+            fft.performFrequencyOnlyForwardTransform(frame.data());
+
+            for (int bin = 0; bin < numBins; ++bin)
+                power[(size_t)bin] += (double)frame[(size_t)bin] * frame[(size_t)bin];
+        }
+
+        std::vector<double> levels;
+        for (double low = 8.0; low < numBins; low *= std::pow(2.0, 1.0 / 3.0))
+        {
+            const int first = (int)low, last = juce::jmin(numBins, (int)(low * std::pow(2.0, 1.0 / 3.0)) + 1);
+            double sum = 0.0;
+            for (int bin = first; bin < last; ++bin)
+                sum += power[(size_t)bin];
+
+            levels.push_back(10.0 * std::log10(sum / (last - first) + 1.0e-20));
+        }
+
+        return levels;
+    };
+
+    double sum = 0.0;
+    int count = 0;
+
+    for (int ch = 0; ch < ref.numChannels; ++ch)
+    {
+        const auto a = bandLevelsDb(out, ch), b = bandLevelsDb(ref, ch);
+        const double floorDb = juce::jmax(*std::max_element(a.begin(), a.end()),
+                                          *std::max_element(b.begin(), b.end())) - 100.0;
+
+        for (size_t band = 0; band < a.size(); ++band)
+        {
+            if (a[band] < floorDb && b[band] < floorDb) continue;
+
+            sum += std::abs(juce::jmax(a[band], floorDb) - juce::jmax(b[band], floorDb));
+            ++count;
+        }
+    }
+
+    return count > 0 ? sum / count : 0.0;
+}
+
+// --- Render cases ---
+
+constexpr double renderRate = 48000.0;
+constexpr int renderBlockSize = 173;   // Not a multiple of the tile
+constexpr double renderSeconds = 0.375; // One kick and one snare of the drum loop
+constexpr juce::int64 renderSeed = 1;
+
+enum class Input
+{
+    Stereo,   // Drums plus a sweep, the sweep inverted on the right
+    DualMono, // Drums on both sides: exercises the dual-mono path
+    Silence   // The engine must stay exactly silent (and fall asleep)
+};
+
+struct RenderCase
+{
+    std::string name;
+    Tolerance tolerance = Tolerance::Db120;
+    ParameterSnapshot params;
+    Input input = Input::Stereo;
+    EngineQuality quality = EngineQuality::High;
+    bool linearPhase = false;
+    bool linearCrossover = false;
+};
+
+/** A busy but stable patch: every stage on, resonator loop well below self-oscillation. */
+inline ParameterSnapshot makeBusyParams()
+{
+    ParameterSnapshot p;
+    p.drive = 0.6f;
+    p.fold = 0.3f;
+    p.stages = 4;
+    p.fbAmount = 0.5f;
+    p.fbTime = 40.0f;
+    p.scramble = 0.4f;
+    p.width = 0.8f;
+    p.squeeze = 0.3f;
+    return p;
+}
+
+/** Appends a case with default settings and returns it for the caller to adjust. */
+inline RenderCase& addCase(std::vector<RenderCase>& cases, std::string name, const ParameterSnapshot& params)
+{
+    RenderCase c;
+    c.name = std::move(name);
+    c.params = params;
+    cases.push_back(c);
+    return cases.back();
+}
+
+/** The case's stereo input, renderSeconds long. */
+inline Render makeInput(const RenderCase& c)
+{
+    const int numSamples = (int)(renderRate * renderSeconds);
+
+    Render in;
+    in.numChannels = 2;
+    in.numSamples = numSamples;
+    in.samples.assign((size_t)numSamples * 2, 0.0f);
+
+    if (c.input != Input::Silence)
+    {
+        const auto drums = bench::makeDrumLoop(renderRate, numSamples);
+        const auto sweep = bench::makeSweep(renderRate, numSamples);
+        const float sweepGain = c.input == Input::Stereo ? 0.3f : 0.0f;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            in.samples[(size_t)i] = drums[(size_t)i] + sweepGain * sweep[(size_t)i];
+            in.samples[(size_t)(numSamples + i)] = drums[(size_t)i] - sweepGain * sweep[(size_t)i];
+        }
+    }
+
+    return in;
+}
+
+/** Quality, crossovers and seed: everything but the parameters, which go with each block. */
+template <typename Engine>
+void configure(Engine& engine, const RenderCase& c)
+{
+    engine.setQuality(c.quality);
+    engine.setLinearPhase(c.linearPhase);
+    engine.setLinearCrossover(c.linearCrossover);
+    engine.setRandomSeed(renderSeed);
+}
+
+/** The case through AetherEngine<float, 2>, renderBlockSize samples at a time. */
+inline Render renderStereo(const RenderCase& c)
+{
+    auto out = makeInput(c);
+    auto engine = std::make_unique<AetherEngine<float, 2>>();
+    engine->prepare({ renderRate, (juce::uint32)renderBlockSize, 2 });
+    configure(*engine, c);
+
+    float* channels[] = { out.samples.data(), out.samples.data() + out.numSamples };
+
+    for (int start = 0; start < out.numSamples; start += renderBlockSize)
+    {
+        juce::AudioBuffer<float> block(channels, 2, start, juce::jmin(renderBlockSize, out.numSamples - start));
+        engine->process(block, c.params);
+    }
+
+    return out;
+}
+
+// --- Comparison ---
+
+inline Comparison compare(const Render& out, const Render& ref, Tolerance tolerance)
+{
+    char text[64];
+
+    if (out.numChannels != ref.numChannels || out.numSamples != ref.numSamples)
+    {
+        std::snprintf(text, sizeof(text), "shape %dx%d, reference %dx%d",
+                      out.numChannels, out.numSamples, ref.numChannels, ref.numSamples);
+        return { false, text };
+    }
+
+    switch (tolerance)
+    {
+        case Tolerance::BitExact:
+        {
+            const bool same = bitExact(out, ref);
+            return { same, same ? "identical" : "samples differ (error " + std::to_string(errorDb(out, ref)) + " dB)" };
+        }
+
+        case Tolerance::Db120:
+        {
+            const double db = errorDb(out, ref);
+            if (db <= -400.0) return { true, "identical" };
+
+            std::snprintf(text, sizeof(text), "error %.1f dB", db);
+            return { db <= -120.0, text };
+        }
+
+        case Tolerance::Spectral:
+        {
+            const double distance = spectralDistanceDb(out, ref);
+            std::snprintf(text, sizeof(text), "spectral distance %.3f dB", distance);
+            return { distance <= 0.75, text };
+        }
+    }
+
+    return {};
+}
+
+} // namespace test
+} // namespace aether
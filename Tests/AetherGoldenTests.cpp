@@ -0,0 +1,195 @@
+/*
+  ==============================================================================
+
+    AetherGoldenTests.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    "golden" suite: every factory preset and a grid over the engine's
+    stages and settings, rendered through AetherEngine<float, 2> and compared
+    with the reference render stored for the case.
+
+    Renders are fully deterministic: fixed input (drums plus a sweep, L and R
+    different), fixed sample rate, odd host block size (tiles get split),
+    and the engine's noise and chaos LFO seeded. The references live in
+    Tests/References. A case with no reference fails: only --refresh writes
+    references (from the current build), so a new case or a change to the
+    sound has to be accepted explicitly and committed with its references.
+    --refresh also rewrites PROVENANCE.txt; a failure names the build that
+    rendered the references when it is not this one.
+
+  ==============================================================================
+*/
+
+#include "AetherTestSuites.h"
+#include "AetherGolden.h"
+
+namespace aether
+{
+namespace test
+{
+
+namespace
+{
+
+std::vector<RenderCase> makeCases()
+{
+    std::vector<RenderCase> cases;
+
+    for (auto& preset : AetherPresets::getFactoryPresets())
+    {
+        ParameterSnapshot p;
+        p.applyPreset(preset);
+        addCase(cases, "presets/" + preset.name.toStdString(), p);
+    }
+
+    addCase(cases, "grid/default", ParameterSnapshot());
+
+    static const char* algoNames[] = { "None", "SoftClip", "HardClip", "SineFold", "TriangleWarp", "BitCrush",
+                                       "SampleReduce", "AsymSaturation", "Rectify", "Tanh", "SoftFold", "Chebyshev" };
+    for (int a = 0; a < (int)DistortionAlgo::Count; ++a)
+    {
+        ParameterSnapshot p;
+        p.drive = 0.7f;
+        p.stages = 3;
+        p.algoPos = p.algoNeg = (DistortionAlgo)a;
+        addCase(cases, std::string("grid/algo/") + algoNames[a], p);
+    }
+
+    {
+        ParameterSnapshot p;
+        p.drive = 0.8f;
+        p.stages = 12;
+        p.algoPos = DistortionAlgo::Tanh;
+        p.algoNeg = DistortionAlgo::SineFold;
+        addCase(cases, "grid/stages12", p);
+    }
+    {
+        ParameterSnapshot p;
+        p.drive = 0.6f;
+        p.fold = 0.6f;
+        addCase(cases, "grid/fold", p);
+    }
+    {
+        ParameterSnapshot p;
+        p.cutoff = 800.0f;
+        p.res = 0.7f;
+        p.morph = 0.5f;
+        addCase(cases, "grid/filter/morph", p);
+    }
+    {
+        ParameterSnapshot p;
+        p.vowelMode = true;
+        p.res = 0.8f;
+        p.morph = 0.4f;
+        addCase(cases, "grid/filter/vowel", p);
+    }
+    {
+        ParameterSnapshot p;
+        p.fbAmount = 0.7f;
+        p.fbTime = 8.0f;
+        p.scramble = 0.4f;
+        addCase(cases, "grid/resonator", p);
+    }
+    {
+        ParameterSnapshot p;
+        p.width = 1.0f;
+        p.squeeze = 0.7f;
+        addCase(cases, "grid/width", p);
+    }
+    {
+        ParameterSnapshot p;
+        p.sub = 1.8f;
+        p.xover = 250.0f;
+        addCase(cases, "grid/sub", p);
+    }
+
+    addCase(cases, "grid/eco", makeBusyParams()).quality = EngineQuality::Eco;
+    addCase(cases, "grid/linearPhase", makeBusyParams()).linearPhase = true;
+    addCase(cases, "grid/linearCrossover", makeBusyParams()).linearCrossover = true;
+    addCase(cases, "grid/dualmono", makeBusyParams()).input = Input::DualMono;
+
+    // Noise is compared by spectrum: a change of generator keeps the colour, not the samples
+    static const char* noiseNames[] = { "White", "Pink", "Crackle" };
+    for (int t = 0; t < 3; ++t)
+    {
+        auto p = makeBusyParams();
+        p.noiseLevel = 0.4f;
+        p.noiseType = t;
+        addCase(cases, std::string("grid/noise/") + noiseNames[t], p).tolerance = Tolerance::Spectral;
+    }
+
+    auto& silence = addCase(cases, "grid/silence", makeBusyParams());
+    silence.input = Input::Silence;
+    silence.tolerance = Tolerance::BitExact;
+
+    return cases;
+}
+
+/** "presets/INIT / REESE" -> "presets_INIT___REESE.f32" */
+std::string referenceFileName(const std::string& caseName)
+{
+    std::string file;
+    for (char ch : caseName)
+        file += juce::CharacterFunctions::isLetterOrDigit(ch) ? ch : '_';
+    return file + ".f32";
+}
+
+} // namespace
+
+void runGoldenSuite(Summary& summary, const Options& options)
+{
+    if (options.referenceDir.empty())
+    {
+        summary.skip("golden", "no --references directory");
+        return;
+    }
+
+    const juce::File directory(juce::String(options.referenceDir));
+    const auto provenancePath = directory.getChildFile("PROVENANCE.txt").getFullPathName().toStdString();
+
+    if (options.refresh)
+    {
+        directory.createDirectory();
+        if (! writeProvenance(provenancePath))
+            summary.fail("golden", "cannot write " + provenancePath);
+    }
+
+    // A mismatch against references from another build may be that build, not a regression
+    const auto provenance = readProvenance(provenancePath);
+    const auto otherBuild = provenance != describeBuild()
+                          ? " (references from " + (provenance.empty() ? std::string("an unknown build") : provenance) + ")"
+                          : std::string();
+
+    for (auto& c : makeCases())
+    {
+        if (! options.filter.empty() && c.name.find(options.filter) == std::string::npos) continue;
+
+        const auto path = directory.getChildFile(juce::String(referenceFileName(c.name))).getFullPathName().toStdString();
+        const auto out = renderStereo(c);
+
+        if (options.refresh)
+        {
+            if (writeReference(path, out)) summary.pass(c.name, "reference written");
+            else summary.fail(c.name, "cannot write " + path);
+            continue;
+        }
+
+        Render reference;
+        if (! readReference(path, reference))
+        {
+            summary.fail(c.name, "no reference at " + path + " (run with --refresh)");
+            continue;
+        }
+
+        const auto result = compare(out, reference, c.tolerance);
+        const auto detail = std::string(toleranceName(c.tolerance)) + ": " + result.detail;
+
+        if (result.passed) summary.pass(c.name, detail);
+        else summary.fail(c.name, detail + otherBuild);
+    }
+}
+
+} // namespace test
+} // namespace aether
@@ -0,0 +1,238 @@
+/*
+  ==============================================================================
+
+    AetherKernelTests.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    "kernels" suite: every kernel table this CPU can run, checked bit for
+    bit against the scalar code it replaces. The distortion against
+    AetherDistortion::processSample for every positive / negative algorithm
+    pair, stage count and fold mode; the output saturation against
+    std::tanh; the older kernels against their documented formulas.
+
+  ==============================================================================
+*/
+
+#include "AetherTestSuites.h"
+#include "AetherBenchCorpus.h"
+#include "AetherDistortion.h"
+#include "AetherKernels.h"
+#include <cstring>
+#include <vector>
+
+namespace aether
+{
+namespace test
+{
+
+namespace
+{
+
+constexpr int numSamples = 1021; // Odd, so every kernel runs its scalar tail
+constexpr int hold = 4;          // Oversampling factor: fold ramps hold each value this long
+
+float uniform(bench::Random& random) { return (float)(random.next() >> 8) / 16777216.0f; }
+
+/** Loud enough to reach every branch: both signs, past the clamps, and exact zeros. */
+std::vector<float> makeSignal(bench::Random& random, float peak)
+{
+    std::vector<float> x((size_t)numSamples);
+    for (int i = 0; i < numSamples; ++i)
+        x[(size_t)i] = (i % 97 == 0) ? 0.0f : (uniform(random) * 2.0f - 1.0f) * peak;
+    return x;
+}
+
+/** Index of the first sample that differs in its bits, or -1. */
+int firstMismatch(const float* a, const float* b, int n)
+{
+    for (int i = 0; i < n; ++i)
+        if (std::memcmp(a + i, b + i, sizeof(float)) != 0)
+            return i;
+    return -1;
+}
+
+std::string mismatchDetail(const char* what, int at, float got, float expected)
+{
+    char text[160];
+    std::snprintf(text, sizeof(text), "%s: sample %d is %.9g, scalar %.9g", what, at, got, expected);
+    return text;
+}
+
+/** Fold off, constant, and ramped across the 0.001 threshold at the hold rate. */
+enum class FoldMode { Off, Constant, Ramp };
+
+bool checkDistortion(const kernels::KernelTable& table, std::string& detail)
+{
+    bench::Random random(0xd157u);
+    AetherDistortion<float> scalar;
+
+    const auto input = makeSignal(random, 1.5f);
+    std::vector<float> drive((size_t)numSamples), tilt((size_t)numSamples);
+    std::vector<float> foldRamp((size_t)(numSamples / hold + 1));
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        drive[(size_t)i] = uniform(random) * 1.5f;
+        tilt[(size_t)i] = (uniform(random) * 2.0f - 1.0f) * 0.07f;
+    }
+
+    for (size_t r = 0; r < foldRamp.size(); ++r)
+        foldRamp[r] = (float)r / (float)foldRamp.size() * 0.01f; // Starts under the threshold
+
+    std::vector<float> got((size_t)numSamples), expected((size_t)numSamples);
+
+    for (int algoPos = 0; algoPos < (int)DistortionAlgo::Count; ++algoPos)
+        for (int algoNeg = 0; algoNeg < (int)DistortionAlgo::Count; ++algoNeg)
+            for (int stages : { 1, 3, 12 })
+                for (auto mode : { FoldMode::Off, FoldMode::Constant, FoldMode::Ramp })
+                {
+                    const float* fold = mode == FoldMode::Ramp ? foldRamp.data() : nullptr;
+                    const float constantFold = mode == FoldMode::Constant ? 0.6f : 0.0f;
+
+                    for (int i = 0; i < numSamples; ++i)
+                    {
+                        const float f = fold != nullptr ? fold[i / hold] : constantFold;
+                        expected[(size_t)i] = scalar.processSample(input[(size_t)i] + tilt[(size_t)i], drive[(size_t)i], f,
+                                                                   (DistortionAlgo)algoPos, (DistortionAlgo)algoNeg, stages)
+                                            - tilt[(size_t)i];
+                    }
+
+                    got = input;
+                    table.distortion(got.data(), drive.data(), tilt.data(), fold, constantFold, hold, numSamples,
+                                     algoPos, algoNeg, stages);
+
+                    const int at = firstMismatch(got.data(), expected.data(), numSamples);
+                    if (at >= 0)
+                    {
+                        char what[96];
+                        std::snprintf(what, sizeof(what), "distortion %d/%d x%d fold %d", algoPos, algoNeg, stages, (int)mode);
+                        detail = mismatchDetail(what, at, got[(size_t)at], expected[(size_t)at]);
+                        return false;
+                    }
+                }
+
+    return true;
+}
+
+bool checkSumSaturate(const kernels::KernelTable& table, std::string& detail)
+{
+    bench::Random random(0x7a11u);
+    const auto low = makeSignal(random, 3.0f);
+    const auto high = makeSignal(random, 3.0f);
+
+    std::vector<float> got((size_t)numSamples), expected((size_t)numSamples);
+    for (int i = 0; i < numSamples; ++i)
+        expected[(size_t)i] = std::tanh(low[(size_t)i] + high[(size_t)i]);
+
+    table.sumSaturate(got.data(), low.data(), high.data(), numSamples);
+    int at = firstMismatch(got.data(), expected.data(), numSamples);
+
+    if (at < 0) // In place, as the engine calls it
+    {
+        got = low;
+        table.sumSaturate(got.data(), got.data(), high.data(), numSamples);
+        at = firstMismatch(got.data(), expected.data(), numSamples);
+    }
+
+    if (at >= 0)
+    {
+        detail = mismatchDetail("sumSaturate", at, got[(size_t)at], expected[(size_t)at]);
+        return false;
+    }
+
+    return true;
+}
+
+bool checkOlderKernels(const kernels::KernelTable& table, std::string& detail)
+{
+    bench::Random random(0x01d5u);
+    const auto l = makeSignal(random, 1.2f);
+    const auto r = makeSignal(random, 1.2f);
+    const auto dry = makeSignal(random, 1.0f);
+
+    std::vector<float> amount((size_t)(numSamples / hold + 1)), mix((size_t)numSamples);
+    for (auto& a : amount) a = uniform(random);
+    for (auto& m : mix) m = uniform(random);
+
+    std::vector<float> got((size_t)numSamples), expected((size_t)numSamples);
+
+    auto compare = [&](const char* what)
+    {
+        const int at = firstMismatch(got.data(), expected.data(), numSamples);
+        if (at >= 0)
+            detail = mismatchDetail(what, at, got[(size_t)at], expected[(size_t)at]);
+        return at < 0;
+    };
+
+    for (int i = 0; i < numSamples; ++i)
+        expected[(size_t)i] = (std::abs(l[(size_t)i]) + std::abs(r[(size_t)i])) * 0.5f;
+    table.inputEnergy(l.data(), r.data(), got.data(), numSamples);
+    if (! compare("inputEnergy")) return false;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float x = l[(size_t)i];
+        expected[(size_t)i] = x * (1.0f + (1.0f / std::sqrt(std::abs(x) + 0.01f) - 1.0f) * amount[(size_t)(i / hold)]);
+    }
+    got = l;
+    table.squeeze(got.data(), numSamples, amount.data(), 0.0f, hold);
+    if (! compare("squeeze")) return false;
+
+    for (int i = 0; i < numSamples; ++i)
+        expected[(size_t)i] = r[(size_t)i] * mix[(size_t)i] + dry[(size_t)i] * (1.0f - mix[(size_t)i]);
+    got = r;
+    table.dryWetMix(got.data(), dry.data(), mix.data(), 0.0f, numSamples);
+    if (! compare("dryWetMix")) return false;
+
+    int above = 0;
+    for (int i = 0; i < numSamples; ++i)
+        above += std::abs(l[(size_t)i]) >= 0.9f ? 1 : 0;
+
+    const int counted = table.countAbove(l.data(), numSamples, 0.9f);
+    if (counted != above)
+    {
+        detail = "countAbove: " + std::to_string(counted) + ", scalar " + std::to_string(above);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+void runKernelSuite(Summary& summary, const Options& options)
+{
+    const kernels::KernelTable* tables[kernels::maxTables];
+    const int count = kernels::getAvailable(tables);
+
+    struct Check
+    {
+        const char* name;
+        bool (*run)(const kernels::KernelTable&, std::string&);
+    };
+
+    const Check checks[] = {
+        { "distortion", checkDistortion },
+        { "sumSaturate", checkSumSaturate },
+        { "older", checkOlderKernels },
+    };
+
+    for (int t = 0; t < count; ++t)
+        for (auto& check : checks)
+        {
+            const std::string name = std::string("kernels/") + tables[t]->isaName + "/" + check.name;
+            if (! options.filter.empty() && name.find(options.filter) == std::string::npos)
+                continue;
+
+            std::string detail;
+            if (check.run(*tables[t], detail))
+                summary.pass(name, "bit-identical to the scalar path");
+            else
+                summary.fail(name, detail);
+        }
+}
+
+} // namespace test
+} // namespace aether
@@ -0,0 +1,169 @@
+/*
+  ==============================================================================
+
+    AetherLaneTests.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    "lanes" suite: AetherLaneEngine against AetherEngine<float, 2>.
+
+    Two lanes forming one stereo unit must repeat the stereo engine bit for
+    bit, across the oversampling filters, both crossovers, Eco, vowel mode,
+    noise and silence. Eight lanes carrying four copies of the same pair
+    must give four bit-identical pairs: no lane leaks into another, and
+    every lane position runs the same code. (Against the stereo render they
+    differ by the rounding of the bus-wide flux, which bit crushing and the
+    formant peaks can lift to -80 dB.) An idle (nullptr) lane is never
+    written.
+
+  ==============================================================================
+*/
+
+#include "AetherTestSuites.h"
+#include "AetherGolden.h"
+#include "AetherLaneEngine.h"
+
+namespace aether
+{
+namespace test
+{
+
+namespace
+{
+
+std::vector<RenderCase> makeCases()
+{
+    std::vector<RenderCase> cases;
+
+    addCase(cases, "busy", makeBusyParams());
+    addCase(cases, "eco", makeBusyParams()).quality = EngineQuality::Eco;
+    addCase(cases, "linearPhase", makeBusyParams()).linearPhase = true;
+    addCase(cases, "linearPhaseEco", makeBusyParams()).linearPhase = true;
+    cases.back().quality = EngineQuality::Eco;
+    addCase(cases, "linearCrossover", makeBusyParams()).linearCrossover = true;
+
+    auto vowel = makeBusyParams();
+    vowel.vowelMode = true;
+    vowel.res = 0.8f;
+    addCase(cases, "vowel", vowel);
+
+    auto noise = makeBusyParams();
+    noise.noiseLevel = 0.4f;
+    addCase(cases, "noise", noise);
+
+    auto crush = makeBusyParams();
+    crush.algoPos = DistortionAlgo::BitCrush;
+    crush.algoNeg = DistortionAlgo::SineFold;
+    crush.stages = 12;
+    addCase(cases, "crush", crush);
+
+    addCase(cases, "silence", makeBusyParams()).input = Input::Silence;
+    return cases;
+}
+
+/**
+ * copies of the input pair on lanes (0, 1), (2, 3), ...; returns every lane.
+ * idleLane >= 0 is passed as nullptr and its slot in the result is left as is.
+ */
+Render renderLanes(const RenderCase& c, int copies, int idleLane = -1)
+{
+    const auto in = makeInput(c);
+    const int numLanes = copies * 2;
+
+    Render out;
+    out.numChannels = numLanes;
+    out.numSamples = in.numSamples;
+    out.samples.assign((size_t)numLanes * (size_t)in.numSamples, 0.0f);
+
+    std::vector<AetherLaneEngine::Unit> units;
+    for (int u = 0; u < copies; ++u)
+    {
+        units.push_back({ 2 * u, 2 * u + 1 });
+        for (int side = 0; side < 2; ++side)
+            std::copy(in.channel(side), in.channel(side) + in.numSamples,
+                      out.samples.begin() + (ptrdiff_t)(2 * u + side) * in.numSamples);
+    }
+
+    auto engine = std::make_unique<AetherLaneEngine>();
+    engine->prepare({ renderRate, (juce::uint32)renderBlockSize, (juce::uint32)numLanes }, units);
+    configure(*engine, c);
+
+    for (int start = 0; start < out.numSamples; start += renderBlockSize)
+    {
+        float* channels[AetherLaneEngine::maxLanes] = {};
+        for (int k = 0; k < numLanes; ++k)
+            channels[k] = k == idleLane ? nullptr : out.samples.data() + (size_t)k * (size_t)out.numSamples + (size_t)start;
+
+        engine->process(channels, juce::jmin(renderBlockSize, out.numSamples - start), c.params);
+    }
+
+    return out;
+}
+
+/** Lanes 2u and 2u + 1 of a lane render, as a stereo render. */
+Render pairOf(const Render& lanes, int u)
+{
+    Render pair;
+    pair.numChannels = 2;
+    pair.numSamples = lanes.numSamples;
+    pair.samples.assign(lanes.channel(2 * u), lanes.channel(2 * u) + 2 * lanes.numSamples);
+    return pair;
+}
+
+bool wants(const Options& options, const std::string& name)
+{
+    return options.filter.empty() || name.find(options.filter) != std::string::npos;
+}
+
+} // namespace
+
+void runLaneSuite(Summary& summary, const Options& options)
+{
+    for (auto& c : makeCases())
+    {
+        const std::string stereoName = "lanes/stereo/" + c.name;
+        const std::string octoName = "lanes/octo/" + c.name;
+        if (! wants(options, stereoName) && ! wants(options, octoName)) continue;
+
+        if (wants(options, stereoName))
+        {
+            const auto result = compare(renderLanes(c, 1), renderStereo(c), Tolerance::BitExact);
+            if (result.passed) summary.pass(stereoName, "bit-exact: " + result.detail);
+            else summary.fail(stereoName, "bit-exact: " + result.detail);
+        }
+
+        // Noise is seeded per unit, so the pairs differ by design there
+        if (wants(options, octoName) && c.params.noiseLevel == 0.0f)
+        {
+            const auto lanes = renderLanes(c, 4);
+            const auto first = pairOf(lanes, 0);
+            Comparison worst { true, "" };
+
+            for (int u = 1; u < 4 && worst.passed; ++u)
+                worst = compare(pairOf(lanes, u), first, Tolerance::BitExact);
+
+            if (worst.passed) summary.pass(octoName, "four pairs bit-identical");
+            else summary.fail(octoName, "pairs differ: " + worst.detail);
+        }
+    }
+
+    const std::string idleName = "lanes/idle";
+    if (wants(options, idleName))
+    {
+        RenderCase c;
+        c.name = "idle";
+        c.params = makeBusyParams();
+
+        // Lane 3 idle: its input must come back untouched
+        const auto in = makeInput(c);
+        const auto out = renderLanes(c, 2, 3);
+        const bool untouched = std::equal(in.channel(1), in.channel(1) + in.numSamples, out.channel(3));
+
+        if (untouched) summary.pass(idleName, "nullptr lane left alone");
+        else summary.fail(idleName, "the idle lane's channel was written");
+    }
+}
+
+} // namespace test
+} // namespace aether
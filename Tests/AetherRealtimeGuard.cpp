@@ -0,0 +1,390 @@
+/*
+  ==============================================================================
+
+    AetherRealtimeGuard.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    The interposed functions behind AetherRealtimeGuard.h.
+
+    Defined in the executable, these win symbol resolution over the C
+    library for every caller, JUCE and libstdc++ included. The allocator
+    forwards to glibc's __libc_* entry points. Everything else forwards to
+    the next definition found with dlsym(RTLD_NEXT). Those lookups are done
+    at load time, so nothing is resolved inside a callback.
+
+  ==============================================================================
+*/
+
+#include "AetherRealtimeGuard.h"
+
+#if AETHER_REALTIME_CHECKS
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+
+extern "C"
+{
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+void* __libc_memalign(size_t, size_t);
+void __libc_free(void*);
+}
+
+namespace
+{
+
+// Trivial thread_locals: no TLS wrapper and no allocation on first access
+thread_local int callbackDepth = 0;
+thread_local bool reporting = false; // The report itself allocates and writes
+thread_local const char* firstCall = nullptr; // First violation since selfCheck() cleared it
+
+std::atomic<int> violationCount { 0 };
+std::atomic<bool> printing { true }; // Off during selfCheck()
+
+// Call sites already printed (hash of the return addresses), so a hot path is reported once
+constexpr int maxSites = 256;
+std::atomic<uint64_t> sites[maxSites];
+
+bool isNewSite(uint64_t hash)
+{
+    for (int i = 0; i < maxSites; ++i)
+    {
+        auto& slot = sites[(hash + (uint64_t)i) % maxSites];
+        uint64_t expected = 0;
+        if (slot.compare_exchange_strong(expected, hash)) return true;
+        if (expected == hash) return false;
+    }
+    return false; // Table full: count, but stop printing
+}
+
+void violation(const char* call, size_t bytes = 0)
+{
+    if (callbackDepth == 0 || reporting) return;
+
+    reporting = true;
+    violationCount.fetch_add(1, std::memory_order_relaxed);
+    if (firstCall == nullptr) firstCall = call;
+
+    void* frames[32];
+    const int numFrames = backtrace(frames, 32);
+
+    uint64_t hash = 1469598103934665603ull;
+    for (int i = 1; i < numFrames && i < 12; ++i)
+        hash = (hash ^ (uint64_t)(uintptr_t)frames[i]) * 1099511628211ull;
+
+    if (printing.load(std::memory_order_relaxed) && isNewSite(hash | 1))
+    {
+        if (bytes > 0) std::fprintf(stderr, "\nrealtime violation: %s (%zu bytes) inside the audio callback\n", call, bytes);
+        else std::fprintf(stderr, "\nrealtime violation: %s inside the audio callback\n", call);
+
+        backtrace_symbols_fd(frames + 1, numFrames - 1, 2);
+    }
+
+    reporting = false;
+}
+
+template <typename Fn>
+Fn next(const char* name)
+{
+    return (Fn)dlsym(RTLD_NEXT, name);
+}
+
+using MutexFn = int (*)(pthread_mutex_t*);
+using RwLockFn = int (*)(pthread_rwlock_t*);
+using CondWaitFn = int (*)(pthread_cond_t*, pthread_mutex_t*);
+using CondTimedWaitFn = int (*)(pthread_cond_t*, pthread_mutex_t*, const timespec*);
+using SemWaitFn = int (*)(sem_t*);
+using NanosleepFn = int (*)(const timespec*, timespec*);
+using ClockNanosleepFn = int (*)(clockid_t, int, const timespec*, timespec*);
+using UsleepFn = int (*)(useconds_t);
+using YieldFn = int (*)();
+using ReadFn = ssize_t (*)(int, void*, size_t);
+using WriteFn = ssize_t (*)(int, const void*, size_t);
+using FopenFn = FILE* (*)(const char*, const char*);
+
+MutexFn realMutexLock, realMutexTryLock;
+RwLockFn realRdLock, realWrLock;
+CondWaitFn realCondWait;
+CondTimedWaitFn realCondTimedWait;
+SemWaitFn realSemWait;
+NanosleepFn realNanosleep;
+ClockNanosleepFn realClockNanosleep;
+UsleepFn realUsleep;
+YieldFn realYield;
+ReadFn realRead;
+WriteFn realWrite;
+FopenFn realFopen;
+
+__attribute__((constructor)) void resolve()
+{
+    realMutexLock = next<MutexFn>("pthread_mutex_lock");
+    realMutexTryLock = next<MutexFn>("pthread_mutex_trylock");
+    realRdLock = next<RwLockFn>("pthread_rwlock_rdlock");
+    realWrLock = next<RwLockFn>("pthread_rwlock_wrlock");
+    realCondWait = next<CondWaitFn>("pthread_cond_wait");
+    realCondTimedWait = next<CondTimedWaitFn>("pthread_cond_timedwait");
+    realSemWait = next<SemWaitFn>("sem_wait");
+    realNanosleep = next<NanosleepFn>("nanosleep");
+    realClockNanosleep = next<ClockNanosleepFn>("clock_nanosleep");
+    realUsleep = next<UsleepFn>("usleep");
+    realYield = next<YieldFn>("sched_yield");
+    realRead = next<ReadFn>("read");
+    realWrite = next<WriteFn>("write");
+    realFopen = next<FopenFn>("fopen");
+
+    // The first backtrace() loads the unwinder, which allocates: get that over with
+    void* frames[4];
+    backtrace(frames, 4);
+}
+
+} // namespace
+
+// --- Allocation ---
+
+extern "C" void* malloc(size_t size) noexcept
+{
+    violation("malloc", size);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) noexcept
+{
+    violation("calloc", count * size);
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* p, size_t size) noexcept
+{
+    violation("realloc", size);
+    return __libc_realloc(p, size);
+}
+
+extern "C" void free(void* p) noexcept
+{
+    if (p != nullptr) violation("free");
+    __libc_free(p);
+}
+
+extern "C" void* memalign(size_t alignment, size_t size) noexcept
+{
+    violation("memalign", size);
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" void* aligned_alloc(size_t alignment, size_t size) noexcept
+{
+    violation("aligned_alloc", size);
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" int posix_memalign(void** result, size_t alignment, size_t size) noexcept
+{
+    violation("posix_memalign", size);
+    *result = __libc_memalign(alignment, size);
+    return *result != nullptr || size == 0 ? 0 : 12; // ENOMEM
+}
+
+// --- Locks, sleeps and I/O ---
+
+extern "C" int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+{
+    violation("pthread_mutex_lock");
+    return realMutexLock(mutex);
+}
+
+// Never blocks, but a try-lock on the audio thread (juce::ScopedTryLock) still
+// means sharing state through a lock, and a failed try drops the block's work
+extern "C" int pthread_mutex_trylock(pthread_mutex_t* mutex) noexcept
+{
+    violation("pthread_mutex_trylock");
+    return realMutexTryLock(mutex);
+}
+
+extern "C" int pthread_rwlock_rdlock(pthread_rwlock_t* lock) noexcept
+{
+    violation("pthread_rwlock_rdlock");
+    return realRdLock(lock);
+}
+
+extern "C" int pthread_rwlock_wrlock(pthread_rwlock_t* lock) noexcept
+{
+    violation("pthread_rwlock_wrlock");
+    return realWrLock(lock);
+}
+
+extern "C" int pthread_cond_wait(pthread_cond_t* condition, pthread_mutex_t* mutex)
+{
+    violation("pthread_cond_wait");
+    return realCondWait(condition, mutex);
+}
+
+extern "C" int pthread_cond_timedwait(pthread_cond_t* condition, pthread_mutex_t* mutex, const timespec* deadline)
+{
+    violation("pthread_cond_timedwait");
+    return realCondTimedWait(condition, mutex, deadline);
+}
+
+extern "C" int sem_wait(sem_t* semaphore)
+{
+    violation("sem_wait");
+    return realSemWait(semaphore);
+}
+
+extern "C" int nanosleep(const timespec* duration, timespec* remaining)
+{
+    violation("nanosleep");
+    return realNanosleep(duration, remaining);
+}
+
+extern "C" int clock_nanosleep(clockid_t clock, int flags, const timespec* duration, timespec* remaining)
+{
+    violation("clock_nanosleep");
+    return realClockNanosleep(clock, flags, duration, remaining);
+}
+
+extern "C" int usleep(useconds_t microseconds)
+{
+    violation("usleep");
+    return realUsleep(microseconds);
+}
+
+extern "C" int sched_yield() noexcept
+{
+    violation("sched_yield");
+    return realYield();
+}
+
+extern "C" ssize_t read(int fd, void* buffer, size_t size)
+{
+    violation("read");
+    return realRead(fd, buffer, size);
+}
+
+extern "C" ssize_t write(int fd, const void* buffer, size_t size)
+{
+    violation("write");
+    return realWrite(fd, buffer, size);
+}
+
+extern "C" FILE* fopen(const char* path, const char* mode)
+{
+    violation("fopen");
+    return realFopen(path, mode);
+}
+
+namespace aether
+{
+namespace test
+{
+namespace realtime
+{
+
+bool isAvailable() { return true; }
+
+ScopedAudioCallback::ScopedAudioCallback()  { ++callbackDepth; }
+ScopedAudioCallback::~ScopedAudioCallback() { --callbackDepth; }
+
+int getViolationCount() { return violationCount.load(); }
+void resetViolations() { violationCount.store(0); }
+
+std::string selfCheck()
+{
+    std::string missed;
+    printing = false;
+
+    // By name: fopen, say, also allocates, and that must not stand in for it
+    auto expect = [&missed](const char* name, auto&& call)
+    {
+        firstCall = nullptr;
+        {
+            ScopedAudioCallback callback;
+            call();
+        }
+
+        if (firstCall == nullptr || std::string(firstCall) != name)
+            missed += (missed.empty() ? "" : ", ") + std::string(name);
+    };
+
+    static void* volatile block = nullptr;
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_rwlock_t rwlock = PTHREAD_RWLOCK_INITIALIZER;
+    pthread_cond_t condition = PTHREAD_COND_INITIALIZER;
+    sem_t semaphore;
+    sem_init(&semaphore, 0, 1);
+    const timespec zero {};
+    char byte = 0;
+
+    expect("malloc", [] { block = malloc(16); });
+    expect("free", [] { free(block); });
+    expect("pthread_mutex_lock", [&] { pthread_mutex_lock(&mutex); pthread_mutex_unlock(&mutex); });
+    expect("pthread_mutex_trylock", [&] { if (pthread_mutex_trylock(&mutex) == 0) pthread_mutex_unlock(&mutex); });
+    expect("pthread_rwlock_rdlock", [&] { pthread_rwlock_rdlock(&rwlock); pthread_rwlock_unlock(&rwlock); });
+    expect("pthread_rwlock_wrlock", [&] { pthread_rwlock_wrlock(&rwlock); pthread_rwlock_unlock(&rwlock); });
+
+    // A deadline in the past returns at once; pthread_cond_wait has no such form and is not probed
+    pthread_mutex_lock(&mutex);
+    expect("pthread_cond_timedwait", [&] { pthread_cond_timedwait(&condition, &mutex, &zero); });
+    pthread_mutex_unlock(&mutex);
+
+    expect("sem_wait", [&] { sem_wait(&semaphore); });
+    expect("nanosleep", [&] { nanosleep(&zero, nullptr); });
+    expect("clock_nanosleep", [&] { clock_nanosleep(CLOCK_MONOTONIC, 0, &zero, nullptr); });
+    expect("usleep", [] { usleep(0); });
+    expect("sched_yield", [] { sched_yield(); });
+    expect("read", [&] { (void)read(0, &byte, 0); });
+    expect("write", [&] { (void)write(2, &byte, 0); });
+
+    FILE* file = nullptr;
+    expect("fopen", [&] { file = fopen("/dev/null", "r"); });
+    if (file != nullptr) fclose(file);
+
+    sem_destroy(&semaphore);
+    pthread_rwlock_destroy(&rwlock);
+    pthread_cond_destroy(&condition);
+    pthread_mutex_destroy(&mutex);
+
+    printing = true;
+    return missed;
+}
+
+} // namespace realtime
+} // namespace test
+} // namespace aether
+
+#else
+
+namespace aether
+{
+namespace test
+{
+namespace realtime
+{
+
+bool isAvailable() { return false; }
+
+ScopedAudioCallback::ScopedAudioCallback() {}
+ScopedAudioCallback::~ScopedAudioCallback() {}
+
+int getViolationCount() { return 0; }
+void resetViolations() {}
+std::string selfCheck() { return {}; }
+
+} // namespace realtime
+} // namespace test
+} // namespace aether
+
+#endif
@@ -0,0 +1,61 @@
+/*
+  ==============================================================================
+
+    AetherRealtimeGuard.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    Catches calls that can block the audio thread: heap allocation and
+    release, mutex (try-locks included) and rwlock acquisition, condition
+    and semaphore waits, sleeps, yields and file I/O.
+
+    aether_tests defines these functions itself (AETHER_REALTIME_CHECKS,
+    Linux only), so every call in the process goes through the guard
+    first. While the calling thread is inside a ScopedAudioCallback, each
+    such call counts as a violation; the first time a call site is seen its
+    stack is printed. Outside a callback the calls pass straight through.
+    Not compatible with sanitizers, which replace malloc themselves.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <string>
+
+namespace aether
+{
+namespace test
+{
+namespace realtime
+{
+
+/** False where the guard is compiled out: then nothing is ever reported. */
+bool isAvailable();
+
+/** Marks the calling thread as inside the audio callback while it exists. Nests. */
+class ScopedAudioCallback
+{
+public:
+    ScopedAudioCallback();
+    ~ScopedAudioCallback();
+
+    ScopedAudioCallback(const ScopedAudioCallback&) = delete;
+    ScopedAudioCallback& operator=(const ScopedAudioCallback&) = delete;
+};
+
+/** Violations since the last reset, counting repeats from the same call site. */
+int getViolationCount();
+void resetViolations();
+
+/**
+ * Makes each guarded call once inside a callback, in ways that never block,
+ * and returns the ones that went unreported (empty if none). Counts as
+ * violations; prints no stacks.
+ */
+std::string selfCheck();
+
+} // namespace realtime
+} // namespace test
+} // namespace aether
@@ -0,0 +1,231 @@
+/*
+  ==============================================================================
+
+    AetherRealtimeTests.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    "realtime" suite: drives a headless AetherAudioProcessor the way a host
+    and its UI would. Between blocks, unchecked like a message thread, it
+    automates parameters, loads presets, swaps custom noise and requests
+    resets. Every processBlock() runs inside a ScopedAudioCallback, and a
+    case fails if any allocation, lock, sleep or file I/O was seen there,
+    or if processBlock() reported a new latency to the host itself.
+    "realtime/guard" first checks that the guard reports every call it wraps.
+
+  ==============================================================================
+*/
+
+#include "AetherTestSuites.h"
+#include "AetherRealtimeGuard.h"
+#include "AetherBenchCorpus.h"
+#include "PluginProcessor.h"
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <functional>
+#include <limits>
+
+namespace aether
+{
+namespace test
+{
+
+namespace
+{
+
+constexpr double hostRate = 48000.0;
+constexpr int hostBlockSize = 256;
+constexpr int numBlocks = 400;
+
+struct Scenario
+{
+    const char* name;
+    juce::AudioChannelSet layout;
+
+    // Message-thread work before block b; may also poison the block's input
+    std::function<void(AetherAudioProcessor&, bench::Random&, int b, juce::AudioBuffer<float>&)> beforeBlock;
+
+    // Host block size for block b (at most twice the prepared size)
+    std::function<int(bench::Random&, int b)> blockSize;
+};
+
+float uniform(bench::Random& random) { return (float)(random.next() >> 8) / 16777216.0f; }
+
+void setParameter(AetherAudioProcessor& processor, const char* id, float normalised)
+{
+    if (auto* p = processor.apvts.getParameter(id))
+        p->setValueNotifyingHost(normalised);
+}
+
+int fixedBlockSize(bench::Random&, int) { return hostBlockSize; }
+
+std::vector<Scenario> makeScenarios()
+{
+    const auto stereo = juce::AudioChannelSet::stereo();
+    auto nothing = [](AetherAudioProcessor&, bench::Random&, int, juce::AudioBuffer<float>&) {};
+
+    return {
+        { "realtime/steady", stereo, nothing, fixedBlockSize },
+
+        { "realtime/automation", stereo,
+          [](AetherAudioProcessor& processor, bench::Random& random, int b, juce::AudioBuffer<float>&)
+          {
+              // Continuous parameters every block, switches and choices (quality, linear phase, ...) every 8th
+              for (auto* p : processor.getParameters())
+                  if (! p->isDiscrete() || b % 8 == 0)
+                      p->setValueNotifyingHost(uniform(random));
+          },
+          fixedBlockSize },
+
+        { "realtime/presets", stereo,
+          [](AetherAudioProcessor& processor, bench::Random& random, int b, juce::AudioBuffer<float>&)
+          {
+              if (b % 4 == 0)
+                  processor.loadFactoryPreset((int)(random.next() % (uint32_t)AetherPresets::getFactoryPresets().size()));
+          },
+          fixedBlockSize },
+
+        { "realtime/customNoise", stereo,
+          [](AetherAudioProcessor& processor, bench::Random& random, int b, juce::AudioBuffer<float>&)
+          {
+              if (b == 0)
+              {
+                  setParameter(processor, "noiseLevel", 0.5f);
+                  setParameter(processor, "noiseType", 1.0f); // Custom
+              }
+
+              if (b % 4 == 0)
+              {
+                  auto noise = std::make_unique<juce::AudioBuffer<float>>(1 + b % 2, 4000 + b);
+                  for (int ch = 0; ch < noise->getNumChannels(); ++ch)
+                      for (int i = 0; i < noise->getNumSamples(); ++i)
+                          noise->setSample(ch, i, 0.5f * random.bipolar());
+                  processor.loadCustomNoise(std::move(noise));
+              }
+          },
+          fixedBlockSize },
+
+        { "realtime/resets", stereo,
+          [](AetherAudioProcessor& processor, bench::Random& random, int b, juce::AudioBuffer<float>& block)
+          {
+              if (b % 4 == 0)
+                  processor.requestEngineReset();
+
+              // Non-finite input trips the engine's own recovery path
+              if (b % 7 == 0)
+                  block.setSample(0, (int)(random.next() % (uint32_t)block.getNumSamples()),
+                                  std::numeric_limits<float>::quiet_NaN());
+          },
+          fixedBlockSize },
+
+        // Latency changes mid-stream: the dry path follows in processBlock, the host is told later
+        { "realtime/linearPhase", stereo,
+          [](AetherAudioProcessor& processor, bench::Random&, int b, juce::AudioBuffer<float>&)
+          {
+              if (b % 8 == 0)
+                  setParameter(processor, "linearPhase", (b / 8) % 2 ? 1.0f : 0.0f);
+
+              if (b % 24 == 4)
+                  setParameter(processor, "linearCrossover", (b / 24) % 2 ? 1.0f : 0.0f);
+          },
+          fixedBlockSize },
+
+        // Hosts may send fewer samples than prepared, or more (the processor chunks them)
+        { "realtime/blockSizes", stereo, nothing,
+          [](bench::Random& random, int) { return 1 + (int)(random.next() % (uint32_t)(2 * hostBlockSize)); } },
+
+        { "realtime/surround", juce::AudioChannelSet::create5point1(),
+          [](AetherAudioProcessor& processor, bench::Random&, int b, juce::AudioBuffer<float>&)
+          {
+              if (b % 16 == 0)
+                  setParameter(processor, "lfeToSub", (b / 16) % 2 ? 1.0f : 0.0f);
+          },
+          fixedBlockSize },
+    };
+}
+
+} // namespace
+
+void runRealtimeSuite(Summary& summary, const Options& options)
+{
+    if (! realtime::isAvailable())
+    {
+        summary.skip("realtime", "guard not built for this platform");
+        return;
+    }
+
+    // Every guarded call must be seen, or a scenario below could pass by missing it
+    if (options.filter.empty() || std::string("realtime/guard").find(options.filter) != std::string::npos)
+    {
+        const auto missed = realtime::selfCheck();
+        if (missed.empty()) summary.pass("realtime/guard", "every guarded call reported");
+        else summary.fail("realtime/guard", "not reported: " + missed);
+    }
+
+    // The APVTS needs a message manager even with no editor
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    const auto drums = bench::makeDrumLoop(hostRate, (int)hostRate);
+
+    for (auto& scenario : makeScenarios())
+    {
+        if (! options.filter.empty() && std::string(scenario.name).find(options.filter) == std::string::npos) continue;
+
+        auto processor = std::make_unique<AetherAudioProcessor>();
+
+        if (scenario.layout != juce::AudioChannelSet::stereo())
+        {
+            juce::AudioProcessor::BusesLayout layout;
+            layout.inputBuses.add(scenario.layout);
+            layout.outputBuses.add(scenario.layout);
+
+            if (! processor->setBusesLayout(layout))
+            {
+                summary.fail(scenario.name, "layout rejected");
+                continue;
+            }
+        }
+
+        processor->setRateAndBufferSizeDetails(hostRate, hostBlockSize);
+        processor->prepareToPlay(hostRate, hostBlockSize);
+
+        const int numChannels = processor->getTotalNumOutputChannels();
+        juce::AudioBuffer<float> storage(numChannels, 2 * hostBlockSize);
+        juce::MidiBuffer midi;
+        bench::Random random(1);
+        int position = 0;
+        int latencyReports = 0; // setLatencySamples() calls from inside processBlock
+
+        realtime::resetViolations();
+
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            const int n = scenario.blockSize(random, b);
+            if (position + n > (int)drums.size()) position = 0;
+
+            juce::AudioBuffer<float> block(storage.getArrayOfWritePointers(), numChannels, 0, n);
+            for (int ch = 0; ch < numChannels; ++ch)
+                block.copyFrom(ch, 0, drums.data() + position, n);
+            position += n;
+
+            scenario.beforeBlock(*processor, random, b, block);
+
+            const int reportedLatency = processor->getLatencySamples();
+
+            {
+                realtime::ScopedAudioCallback callback;
+                processor->processBlock(block, midi);
+            }
+
+            if (processor->getLatencySamples() != reportedLatency)
+                ++latencyReports;
+        }
+
+        const int violations = realtime::getViolationCount();
+        if (violations > 0) summary.fail(scenario.name, std::to_string(violations) + " blocking calls in processBlock (stacks above)");
+        else if (latencyReports > 0) summary.fail(scenario.name, std::to_string(latencyReports) + " latency reports from processBlock");
+        else summary.pass(scenario.name, std::to_string(numBlocks) + " blocks, no blocking calls");
+    }
+}
+
+} // namespace test
+} // namespace aether
@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    AetherTestMain.cpp
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    aether_tests: regression checks for the DSP, run by ctest.
+
+      aether_tests [suite...] [--references DIR] [--refresh] [--filter TEXT]
+
+    With no suite every suite runs. Exit code 0 when everything checked
+    passed, 1 on any failure, 77 (ctest's skip code) when nothing could be
+    checked (golden run without --references, or no realtime guard on
+    this platform). A golden case whose reference is missing fails.
+
+  ==============================================================================
+*/
+
+#include "AetherTestSuites.h"
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+struct Suite
+{
+    const char* name;
+    void (*run)(aether::test::Summary&, const aether::test::Options&);
+};
+
+const Suite suites[] = {
+    { "golden", aether::test::runGoldenSuite },
+    { "kernels", aether::test::runKernelSuite },
+    { "lanes", aether::test::runLaneSuite },
+    { "realtime", aether::test::runRealtimeSuite },
+};
+
+int usage()
+{
+    std::fprintf(stderr, "usage: aether_tests [suite...] [--references DIR] [--refresh] [--filter TEXT]\nsuites:");
+    for (auto& s : suites)
+        std::fprintf(stderr, " %s", s.name);
+    std::fprintf(stderr, "\n");
+    return 2;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    aether::test::Options options;
+    std::vector<const Suite*> selected;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (std::strcmp(arg, "--refresh") == 0)
+        {
+            options.refresh = true;
+            continue;
+        }
+
+        if (arg[0] == '-' && value == nullptr)
+            return usage();
+
+        if (std::strcmp(arg, "--references") == 0)  options.referenceDir = value;
+        else if (std::strcmp(arg, "--filter") == 0) options.filter = value;
+        else if (arg[0] == '-')                     return usage();
+        else
+        {
+            const Suite* found = nullptr;
+            for (auto& s : suites)
+                if (std::strcmp(arg, s.name) == 0)
+                    found = &s;
+
+            if (found == nullptr)
+                return usage();
+
+            selected.push_back(found);
+            continue;
+        }
+
+        ++i; // Skip the option's value
+    }
+
+    if (selected.empty())
+        for (auto& s : suites)
+            selected.push_back(&s);
+
+    // Same FP environment as a host's audio thread
+    juce::ScopedNoDenormals noDenormals;
+    aether::test::Summary summary;
+
+    for (auto* s : selected)
+        s->run(summary, options);
+
+    std::printf("\n%d passed, %d failed, %d skipped\n", summary.passed, summary.failed, summary.skipped);
+
+    if (summary.failed > 0) return 1;
+    if (summary.passed == 0 && summary.skipped > 0) return 77;
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    AetherTestSuites.h
+    Created: 18 Oct 2026
+    Author:  Antigravity
+
+    Description:
+    The aether_tests suites and what they share: options and the pass /
+    fail / skip tally.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+
+namespace aether
+{
+namespace test
+{
+
+struct Options
+{
+    std::string referenceDir; // Golden references live here (golden is skipped without)
+    bool refresh = false;     // Write references instead of checking them
+    std::string filter;       // Only cases whose name contains this
+};
+
+struct Summary
+{
+    int passed = 0;
+    int failed = 0;
+    int skipped = 0;
+
+    void pass(const std::string& name, const std::string& detail)  { ++passed;  log("PASS", name, detail); }
+    void fail(const std::string& name, const std::string& detail)  { ++failed;  log("FAIL", name, detail); }
+    void skip(const std::string& name, const std::string& detail)  { ++skipped; log("SKIP", name, detail); }
+
+private:
+    static void log(const char* status, const std::string& name, const std::string& detail)
+    {
+        std::printf("%s  %-40s %s\n", status, name.c_str(), detail.c_str());
+    }
+};
+
+/** Factory presets and a parameter grid through AetherEngine, against stored renders. */
+void runGoldenSuite(Summary& summary, const Options& options);
+
+/** Every kernel table this CPU runs, bit for bit against the scalar code it replaces. */
+void runKernelSuite(Summary& summary, const Options& options);
+
+/** AetherLaneEngine against AetherEngine<float, 2> (bit-exact on one stereo unit), and lane isolation on eight lanes. */
+void runLaneSuite(Summary& summary, const Options& options);
+
+/** A headless processor under automation, presets, noise swaps and resets: no blocking call in processBlock(). */
+void runRealtimeSuite(Summary& summary, const Options& options);
+
+} // namespace test
+} // namespace aether